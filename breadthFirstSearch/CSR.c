@@ -0,0 +1,299 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * CSR.c
+ * Definition of CSR.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "CSR.h"
+#include "Parallel.h"
+
+typedef struct buildArgs{
+    int n;
+    const int* edges;
+    int m;
+    bool directed;
+    atomic_int* cursor;     // degree counts, then the next free slot of u
+    long* partial;          // per-thread sums for the prefix pass
+    CSR C;
+} buildArgs;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newCSR()
+// Returns a CSR on n vertices with every offset 0 and room for m neighbors.
+CSR newCSR(int n, int m){
+    CSR C = malloc(sizeof(CSRObj));
+    assert(C!=NULL && "ERROR: newCSR(): NULL CSR");
+    C->n = n;
+    C->offset = calloc(n+2, sizeof(int));
+    C->nbr = malloc((m>0 ? m : 1)*sizeof(int));
+    C->weight = NULL;
+    assert(C->offset!=NULL && C->nbr!=NULL && "ERROR: newCSR(): out of memory");
+    return C;
+}
+
+// freeCSR()
+// Frees heap memory associated with *pC, sets *pC to NULL.
+void freeCSR(CSR* pC){
+    if (pC!=NULL && *pC!=NULL){
+        free((*pC)->offset);
+        free((*pC)->nbr);
+        free((*pC)->weight);
+        free(*pC);
+        *pC = NULL;
+    }
+}
+
+// countTask()
+// Pass 1: every thread counts the endpoints of its slice of the edge array.
+static void countTask(int id, int threads, void* p){
+    buildArgs* A = p;
+    int lo = chunkStart(0, A->m, id, threads);
+    int hi = chunkStart(0, A->m, id+1, threads);
+    for (int i = lo; i < hi; i++){
+        int u = A->edges[2*i];
+        int v = A->edges[2*i+1];
+        if (u<1 || u>A->n || v<1 || v>A->n){
+            fprintf(stderr,
+                    "CSR ERROR: newCSRFromEdges(): edge %d has an endpoint out of range\n", i);
+            exit(EXIT_FAILURE);
+        }
+        atomic_fetch_add_explicit(&A->cursor[u], 1, memory_order_relaxed);
+        if (!A->directed){
+            atomic_fetch_add_explicit(&A->cursor[v], 1, memory_order_relaxed);
+        }
+    }
+}
+
+// sumTask()
+// Pass 2a: every thread totals the degrees of its block of vertices.
+static void sumTask(int id, int threads, void* p){
+    buildArgs* A = p;
+    int lo = chunkStart(1, A->n+1, id, threads);
+    int hi = chunkStart(1, A->n+1, id+1, threads);
+    long s = 0;
+    for (int u = lo; u < hi; u++){
+        s += atomic_load_explicit(&A->cursor[u], memory_order_relaxed);
+    }
+    A->partial[id] = s;
+}
+
+// offsetTask()
+// Pass 2b: every thread turns its block of degrees into offsets, starting from
+// the exclusive prefix left in partial[id], and resets the cursors to them.
+static void offsetTask(int id, int threads, void* p){
+    buildArgs* A = p;
+    int lo = chunkStart(1, A->n+1, id, threads);
+    int hi = chunkStart(1, A->n+1, id+1, threads);
+    int off = (int)A->partial[id];
+    for (int u = lo; u < hi; u++){
+        int d = atomic_load_explicit(&A->cursor[u], memory_order_relaxed);
+        A->C->offset[u] = off;
+        atomic_store_explicit(&A->cursor[u], off, memory_order_relaxed);
+        off += d;
+    }
+}
+
+// scatterTask()
+// Pass 3: every thread claims slots for its slice of the edge array through
+// the atomic cursors and writes the neighbors into them.
+static void scatterTask(int id, int threads, void* p){
+    buildArgs* A = p;
+    int lo = chunkStart(0, A->m, id, threads);
+    int hi = chunkStart(0, A->m, id+1, threads);
+    int* nbr = A->C->nbr;
+    for (int i = lo; i < hi; i++){
+        int u = A->edges[2*i];
+        int v = A->edges[2*i+1];
+        nbr[atomic_fetch_add_explicit(&A->cursor[u], 1, memory_order_relaxed)] = v;
+        if (!A->directed){
+            nbr[atomic_fetch_add_explicit(&A->cursor[v], 1, memory_order_relaxed)] = u;
+        }
+    }
+}
+
+// newCSRFromEdges()
+// Builds a CSR from the m edges stored as pairs in edges[0..2m-1], where edge i
+// is edges[2i] -> edges[2i+1]. If directed is false each edge is stored in
+// both directions. Uses threads worker threads for the three passes: count
+// degrees, prefix sum into offsets, then scatter neighbors through per-vertex
+// atomic cursors. The order inside a neighbor range is unspecified when
+// threads > 1; use sortCSR() for a canonical order.
+// Pre: 1 <= edges[i] <= n
+CSR newCSRFromEdges(int n, const int* edges, int m, bool directed, int threads){
+    if (n<0 || m<0 || (m>0 && edges==NULL)){
+        fprintf(stderr, "CSR ERROR: newCSRFromEdges(): invalid edge array\n");
+        exit(EXIT_FAILURE);
+    }
+    if (threads < 1){
+        threads = 1;
+    }
+    long total = directed ? (long)m : 2L*m;
+    if (total > 2147483647L){
+        fprintf(stderr, "CSR ERROR: newCSRFromEdges(): too many edges\n");
+        exit(EXIT_FAILURE);
+    }
+
+    buildArgs A;
+    A.n = n;
+    A.edges = edges;
+    A.m = m;
+    A.directed = directed;
+    A.cursor = calloc(n+2, sizeof(atomic_int));
+    A.partial = calloc(threads, sizeof(long));
+    A.C = newCSR(n, (int)total);
+    assert(A.cursor!=NULL && A.partial!=NULL && "ERROR: newCSRFromEdges(): out of memory");
+
+    parallelRun(threads, countTask, &A);
+
+    parallelRun(threads, sumTask, &A);
+    long run = 0;
+    for (int t = 0; t < threads; t++){
+        long s = A.partial[t];
+        A.partial[t] = run;
+        run += s;
+    }
+    parallelRun(threads, offsetTask, &A);
+    A.C->offset[n+1] = (int)run;
+
+    parallelRun(threads, scatterTask, &A);
+
+    free(A.cursor);
+    free(A.partial);
+    return A.C;
+}
+
+// transposeCSR()
+// Returns a CSR of C with every arc reversed, so the neighbors of v in it are
+// the vertices with an arc into v. Built by newCSRFromEdges() on threads
+// worker threads, so neighbor order is unspecified when threads > 1. Weights
+// are not copied.
+CSR transposeCSR(CSR C, int threads){
+    if (C==NULL){
+        fprintf(stderr, "CSR ERROR: transposeCSR(): NULL CSR reference\n");
+        exit(EXIT_FAILURE);
+    }
+    int m = C->offset[C->n+1];
+    int* edges = malloc((2L*m+2)*sizeof(int));
+    assert(edges!=NULL && "ERROR: transposeCSR(): out of memory");
+    for (int u = 1; u <= C->n; u++){
+        for (int i = C->offset[u]; i < C->offset[u+1]; i++){
+            edges[2L*i] = C->nbr[i];
+            edges[2L*i+1] = u;
+        }
+    }
+    CSR T = newCSRFromEdges(C->n, edges, m, true, threads);
+    free(edges);
+    return T;
+}
+
+// Manipulation procedures ----------------------------------------------------
+
+typedef struct sortArgs{
+    CSR C;
+    bool dedup;
+    int* degree;        // length of every range after dedup
+    int* nbr;           // compacted neighbor array
+    long* partial;
+} sortArgs;
+
+// compareInt()
+// qsort() comparison for ints.
+static int compareInt(const void* a, const void* b){
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// sortTask()
+// Sorts, and optionally dedups in place, every range in this thread's block.
+static void sortTask(int id, int threads, void* p){
+    sortArgs* A = p;
+    CSR C = A->C;
+    int lo = chunkStart(1, C->n+1, id, threads);
+    int hi = chunkStart(1, C->n+1, id+1, threads);
+    long s = 0;
+    for (int u = lo; u < hi; u++){
+        int* r = C->nbr + C->offset[u];
+        int d = C->offset[u+1] - C->offset[u];
+        qsort(r, d, sizeof(int), compareInt);
+        if (A->dedup && d > 1){
+            int k = 1;
+            for (int i = 1; i < d; i++){
+                if (r[i] != r[k-1]){
+                    r[k++] = r[i];
+                }
+            }
+            d = k;
+        }
+        A->degree[u] = d;
+        s += d;
+    }
+    A->partial[id] = s;
+}
+
+// compactTask()
+// Copies the deduped prefix of every range in this thread's block into its
+// new place and rewrites the offsets of the block.
+static void compactTask(int id, int threads, void* p){
+    sortArgs* A = p;
+    CSR C = A->C;
+    int lo = chunkStart(1, C->n+1, id, threads);
+    int hi = chunkStart(1, C->n+1, id+1, threads);
+    int off = (int)A->partial[id];
+    for (int u = lo; u < hi; u++){
+        memcpy(A->nbr + off, C->nbr + C->offset[u], A->degree[u]*sizeof(int));
+        off += A->degree[u];
+    }
+}
+
+// sortCSR()
+// Sorts every neighbor range of C into increasing order. If dedup is true,
+// repeated neighbors are removed and C is compacted. Pre: C has no weights
+void sortCSR(CSR C, bool dedup, int threads){
+    if (C==NULL){
+        fprintf(stderr, "CSR ERROR: sortCSR(): NULL CSR reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (threads < 1){
+        threads = 1;
+    }
+    sortArgs A;
+    A.C = C;
+    A.dedup = dedup;
+    A.degree = malloc((C->n+2)*sizeof(int));
+    A.partial = calloc(threads, sizeof(long));
+    assert(A.degree!=NULL && A.partial!=NULL && "ERROR: sortCSR(): out of memory");
+
+    parallelRun(threads, sortTask, &A);
+
+    long run = 0;
+    for (int t = 0; t < threads; t++){
+        long s = A.partial[t];
+        A.partial[t] = run;
+        run += s;
+    }
+    if (dedup && run < C->offset[C->n+1]){
+        A.nbr = malloc((run>0 ? run : 1)*sizeof(int));
+        assert(A.nbr!=NULL && "ERROR: sortCSR(): out of memory");
+        parallelRun(threads, compactTask, &A);
+        int off = 0;
+        for (int u = 1; u <= C->n; u++){
+            C->offset[u] = off;
+            off += A.degree[u];
+        }
+        C->offset[C->n+1] = off;
+        free(C->nbr);
+        C->nbr = A.nbr;
+    }
+    free(A.degree);
+    free(A.partial);
+}
@@ -0,0 +1,67 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * CSR.h
+ * Header file for compressed sparse row adjacency functions
+ ***/
+
+#ifndef CSR_H
+#define CSR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+// Exported Types -------------------------------------------------------------
+
+// Vertices are labeled 1..n like a Graph. The neighbors of u are
+// nbr[offset[u]] .. nbr[offset[u+1]-1], so offset has n+2 entries and
+// offset[n+1] is the total number of stored neighbors. weight is NULL for an
+// unweighted graph, and otherwise weight[i] is the weight of the arc to nbr[i].
+typedef struct CSRObj{
+    int n;
+    int* offset;
+    int* nbr;
+    int* weight;
+} CSRObj;
+
+typedef CSRObj* CSR;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newCSR()
+// Returns a CSR on n vertices with every offset 0, room for m neighbors and
+// no weights.
+CSR newCSR(int n, int m);
+
+// freeCSR()
+// Frees heap memory associated with *pC, sets *pC to NULL.
+void freeCSR(CSR* pC);
+
+// newCSRFromEdges()
+// Builds a CSR from the m edges stored as pairs in edges[0..2m-1], where edge i
+// is edges[2i] -> edges[2i+1]. If directed is false each edge is stored in
+// both directions. Uses threads worker threads for the three passes: count
+// degrees, prefix sum into offsets, then scatter neighbors through per-vertex
+// atomic cursors. The order inside a neighbor range is unspecified when
+// threads > 1; use sortCSR() for a canonical order.
+// Pre: 1 <= edges[i] <= n
+CSR newCSRFromEdges(int n, const int* edges, int m, bool directed, int threads);
+
+// transposeCSR()
+// Returns a CSR of C with every arc reversed, so the neighbors of v in it are
+// the vertices with an arc into v. Built by newCSRFromEdges() on threads
+// worker threads, so neighbor order is unspecified when threads > 1. Weights
+// are not copied.
+CSR transposeCSR(CSR C, int threads);
+
+// Manipulation procedures ----------------------------------------------------
+
+// sortCSR()
+// Sorts every neighbor range of C into increasing order. If dedup is true,
+// repeated neighbors are removed and C is compacted. Pre: C has no weights
+void sortCSR(CSR C, bool dedup, int threads);
+
+#endif
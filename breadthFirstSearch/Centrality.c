@@ -0,0 +1,166 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Centrality.c
+ * Definition of Centrality.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Parallel.h"
+#include "Centrality.h"
+
+typedef struct brandesArgs{
+    CSR C;
+    const int* source;      // the sources to search from
+    int sources;
+    atomic_int next;        // index of the next source to hand out
+    double** acc;           // acc[id] is the private score array of thread id
+} brandesArgs;
+
+// nextRandom()
+// Returns the next value of a xorshift generator, so samples are repeatable.
+static unsigned nextRandom(unsigned* state){
+    unsigned x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// brandesTask()
+// Every thread takes sources one at a time until none are left. For each it
+// runs a BFS that counts the shortest paths sigma[] to every vertex, then
+// walks the vertices back in BFS order so that each one collects the
+// dependencies of the vertices one level below it. Only the vertices a
+// search reached are reset for the next one.
+static void brandesTask(int id, int threads, void* p){
+    brandesArgs* A = p;
+    CSR C = A->C;
+    int n = C->n;
+    int* dist = malloc((n+1)*sizeof(int));
+    int* order = malloc((n+1)*sizeof(int));
+    double* sigma = calloc(n+1, sizeof(double));
+    double* delta = calloc(n+1, sizeof(double));
+    double* acc = calloc(n+1, sizeof(double));
+    assert(dist!=NULL && order!=NULL && sigma!=NULL && delta!=NULL && acc!=NULL
+           && "ERROR: betweenness(): out of memory");
+    for(int u = 0; u<=n; u++){
+        dist[u] = -1;
+    }
+    A->acc[id] = acc;
+
+    for(;;){
+        int j = atomic_fetch_add_explicit(&A->next, 1, memory_order_relaxed);
+        if(j>=A->sources){
+            break;
+        }
+        int s = A->source[j];
+        int head = 0, tail = 0;
+        dist[s] = 0;
+        sigma[s] = 1;
+        order[tail++] = s;
+        while(head<tail){
+            int x = order[head++];
+            for(int i = C->offset[x]; i<C->offset[x+1]; i++){
+                int y = C->nbr[i];
+                if(dist[y]<0){
+                    dist[y] = dist[x]+1;
+                    order[tail++] = y;
+                }
+                if(dist[y]==dist[x]+1){
+                    sigma[y] += sigma[x];
+                }
+            }
+        }
+        for(int k = tail-1; k>=0; k--){
+            int x = order[k];
+            for(int i = C->offset[x]; i<C->offset[x+1]; i++){
+                int y = C->nbr[i];
+                if(dist[y]==dist[x]+1){
+                    delta[x] += sigma[x]/sigma[y]*(1+delta[y]);
+                }
+            }
+            if(x!=s){
+                acc[x] += delta[x];
+            }
+        }
+        for(int k = 0; k<tail; k++){
+            int x = order[k];
+            dist[x] = -1;
+            sigma[x] = 0;
+            delta[x] = 0;
+        }
+    }
+
+    free(dist);
+    free(order);
+    free(sigma);
+    free(delta);
+}
+
+// betweenness()
+// Sets score[v] for 1 <= v <= getOrder(G) to the betweenness of v: the sum
+// over ordered pairs s != v != t of the fraction of shortest s-t paths that
+// pass through v. Edges from addEdge() count in both directions, so halve the
+// scores for the undirected convention. Runs Brandes' algorithm, one BFS per
+// source, with the sources shared by threads worker threads. If 0 < samples
+// < getOrder(G), only that many sources are used, picked at random but
+// repeatably, and the scores are scaled up to estimate the exact ones.
+// Pre: score has room for getOrder(G)+1 doubles
+void betweenness(Graph G, double* score, int samples, int threads){
+    if (G==NULL || score==NULL){
+        fprintf(stderr, "Centrality ERROR: betweenness(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if(threads<1){
+        threads = 1;
+    }
+    brandesArgs A;
+    A.C = newCSRFromGraph(G);
+    int n = A.C->n;
+    int* source = malloc((n+1)*sizeof(int));
+    A.acc = malloc(threads*sizeof(double*));
+    assert(source!=NULL && A.acc!=NULL && "ERROR: betweenness(): out of memory");
+    for(int u = 0; u<n; u++){
+        source[u] = u+1;
+    }
+    A.sources = n;
+    if(samples>0 && samples<n){
+        // the first samples entries of a partial Fisher-Yates shuffle
+        unsigned seed = 2463534242u;
+        for(int i = 0; i<samples; i++){
+            int j = i+(int)(nextRandom(&seed)%(unsigned)(n-i));
+            int t = source[i];
+            source[i] = source[j];
+            source[j] = t;
+        }
+        A.sources = samples;
+    }
+    A.source = source;
+    atomic_init(&A.next, 0);
+    parallelRun(threads, brandesTask, &A);
+
+    double scale = (A.sources>0) ? (double)n/A.sources : 0;
+    for(int v = 1; v<=n; v++){
+        double sum = 0;
+        for(int id = 0; id<threads; id++){
+            sum += A.acc[id][v];
+        }
+        score[v] = sum*scale;
+    }
+
+    for(int id = 0; id<threads; id++){
+        free(A.acc[id]);
+    }
+    free(A.acc);
+    free(source);
+    freeCSR(&A.C);
+}
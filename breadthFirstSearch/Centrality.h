@@ -0,0 +1,24 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Centrality.h
+ * Header file for betweenness centrality functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// betweenness()
+// Sets score[v] for 1 <= v <= getOrder(G) to the betweenness of v: the sum
+// over ordered pairs s != v != t of the fraction of shortest s-t paths that
+// pass through v. Edges from addEdge() count in both directions, so halve the
+// scores for the undirected convention. Runs Brandes' algorithm, one BFS per
+// source, with the sources shared by threads worker threads. If 0 < samples
+// < getOrder(G), only that many sources are used, picked at random but
+// repeatably, and the scores are scaled up to estimate the exact ones.
+// Pre: score has room for getOrder(G)+1 doubles
+void betweenness(Graph G, double* score, int samples, int threads);
@@ -0,0 +1,266 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Components.c
+ * Definition of Components.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Parallel.h"
+#include "Components.h"
+
+// stronglyConnectedComponents()
+// Labels the strongly connected components of G, treating every edge from
+// addEdge() as a pair of arcs. Sets comp[u] for 1 <= u <= getOrder(G) to a
+// component number in 1..k and returns k. Components are numbered in
+// topological order, so every arc u -> v with comp[u] != comp[v] has
+// comp[u] < comp[v]. Uses an explicit stack instead of recursion.
+// Pre: comp has room for getOrder(G)+1 ints
+int stronglyConnectedComponents(Graph G, int* comp){
+    if (G==NULL || comp==NULL){
+        fprintf(stderr, "Components ERROR: stronglyConnectedComponents(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    CSR C = newCSRFromGraph(G);
+    int n = C->n;
+    int* order = calloc(n+1, sizeof(int));  // discovery index, 0 if unvisited
+    int* low = malloc((n+1)*sizeof(int));
+    int* next = malloc((n+1)*sizeof(int));  // next arc of u to look at
+    int* call = malloc((n+1)*sizeof(int));  // vertices of the simulated recursion
+    int* stack = malloc((n+1)*sizeof(int)); // Tarjan's stack of open vertices
+    bool* open = calloc(n+1, sizeof(bool));
+    assert(order!=NULL && low!=NULL && next!=NULL && call!=NULL && stack!=NULL
+           && open!=NULL && "ERROR: stronglyConnectedComponents(): out of memory");
+
+    int counter = 0, k = 0, top = 0;
+    for(int r = 1; r<=n; r++){
+        if(order[r]!=0){
+            continue;
+        }
+        int depth = 0;
+        order[r] = low[r] = ++counter;
+        next[r] = C->offset[r];
+        stack[top++] = r;
+        open[r] = true;
+        call[depth++] = r;
+        while(depth>0){
+            int x = call[depth-1];
+            if(next[x]<C->offset[x+1]){
+                int y = C->nbr[next[x]++];
+                if(order[y]==0){
+                    order[y] = low[y] = ++counter;
+                    next[y] = C->offset[y];
+                    stack[top++] = y;
+                    open[y] = true;
+                    call[depth++] = y;
+                }else if(open[y] && order[y]<low[x]){
+                    low[x] = order[y];
+                }
+            }else{
+                depth--;
+                if(low[x]==order[x]){
+                    // components close sinks first, renumbered below
+                    k++;
+                    int w;
+                    do{
+                        w = stack[--top];
+                        open[w] = false;
+                        comp[w] = k;
+                    }while(w!=x);
+                }
+                if(depth>0){
+                    int p = call[depth-1];
+                    if(low[x]<low[p]){
+                        low[p] = low[x];
+                    }
+                }
+            }
+        }
+    }
+    for(int u = 1; u<=n; u++){
+        comp[u] = k+1-comp[u];
+    }
+
+    free(order);
+    free(low);
+    free(next);
+    free(call);
+    free(stack);
+    free(open);
+    freeCSR(&C);
+    return k;
+}
+
+// condensation()
+// Returns the condensation DAG of G for the k components in comp: a Graph on
+// k vertices with a single arc c -> d whenever some arc of G leads from
+// component c to component d != c. Adjacency lists are sorted.
+// Pre: comp was filled in by stronglyConnectedComponents(G, comp)
+Graph condensation(Graph G, const int* comp, int k){
+    if (G==NULL || comp==NULL){
+        fprintf(stderr, "Components ERROR: condensation(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    CSR C = newCSRFromGraph(G);
+    int m = C->offset[C->n+1];
+    int* edges = malloc((2*m+2)*sizeof(int));
+    assert(edges!=NULL && "ERROR: condensation(): out of memory");
+    int e = 0;
+    for(int u = 1; u<=C->n; u++){
+        for(int i = C->offset[u]; i<C->offset[u+1]; i++){
+            int v = C->nbr[i];
+            if(comp[u]!=comp[v]){
+                edges[2*e] = comp[u];
+                edges[2*e+1] = comp[v];
+                e++;
+            }
+        }
+    }
+    Graph D = newGraphFromEdges(k, edges, e, BUILD_DIRECTED|BUILD_DEDUP, 1);
+    free(edges);
+    freeCSR(&C);
+    return D;
+}
+
+typedef struct unionArgs{
+    CSR C;
+    atomic_int* parent;     // union-find forest, roots have parent[u] == u
+    int* root;
+} unionArgs;
+
+// findRoot()
+// Returns the root of x in the forest P, halving the path on the way up. A
+// halving step is a CAS so that it never undoes a link made meanwhile.
+static int findRoot(atomic_int* P, int x){
+    for(;;){
+        int y = atomic_load_explicit(&P[x], memory_order_relaxed);
+        if(y==x){
+            return x;
+        }
+        int z = atomic_load_explicit(&P[y], memory_order_relaxed);
+        if(z!=y){
+            atomic_compare_exchange_weak_explicit(&P[x], &y, z,
+                memory_order_relaxed, memory_order_relaxed);
+        }
+        x = z;
+    }
+}
+
+// unite()
+// Joins the trees of u and v in P. The larger root is linked below the
+// smaller one by a CAS that fails if another thread linked it first, so
+// parents only ever decrease and the smallest vertex of a tree is its root.
+static void unite(atomic_int* P, int u, int v){
+    for(;;){
+        u = findRoot(P, u);
+        v = findRoot(P, v);
+        if(u==v){
+            return;
+        }
+        if(u<v){
+            int t = u;
+            u = v;
+            v = t;
+        }
+        int expected = u;
+        if(atomic_compare_exchange_strong_explicit(&P[u], &expected, v,
+                memory_order_relaxed, memory_order_relaxed)){
+            return;
+        }
+    }
+}
+
+// uniteTask()
+// Every thread unites the ends of its slice of the arc array. Slices are
+// equal in arcs rather than vertices so that hubs do not stall one thread.
+static void uniteTask(int id, int threads, void* p){
+    unionArgs* A = p;
+    CSR C = A->C;
+    int m = C->offset[C->n+1];
+    int lo = chunkStart(0, m, id, threads);
+    int hi = chunkStart(0, m, id+1, threads);
+    // u is the last vertex whose arcs start at or before lo
+    int a = 1, b = C->n;
+    while(a<b){
+        int mid = (a+b+1)/2;
+        if(C->offset[mid]<=lo){
+            a = mid;
+        }else{
+            b = mid-1;
+        }
+    }
+    int u = a;
+    for(int i = lo; i<hi; i++){
+        while(C->offset[u+1]<=i){
+            u++;
+        }
+        int v = C->nbr[i];
+        if(atomic_load_explicit(&A->parent[u], memory_order_relaxed)
+           !=atomic_load_explicit(&A->parent[v], memory_order_relaxed)){
+            unite(A->parent, u, v);
+        }
+    }
+}
+
+// rootTask()
+// Every thread looks up the roots of its slice of the vertices.
+static void rootTask(int id, int threads, void* p){
+    unionArgs* A = p;
+    int lo = chunkStart(1, A->C->n+1, id, threads);
+    int hi = chunkStart(1, A->C->n+1, id+1, threads);
+    for(int u = lo; u<hi; u++){
+        A->root[u] = findRoot(A->parent, u);
+    }
+}
+
+// connectedComponents()
+// Labels the connected components of G, treating every arc as an undirected
+// edge. Sets label[u] for 1 <= u <= getOrder(G) to a component number in
+// 1..k, numbered in order of their smallest vertex, and returns k. If size is
+// not NULL, size[c] is set to the number of vertices in component c. Runs a
+// concurrent union-find over the arcs on threads worker threads, so there is
+// no per-search reset as with one BFS() per component.
+// Pre: label and size have room for getOrder(G)+1 ints
+int connectedComponents(Graph G, int* label, int* size, int threads){
+    if (G==NULL || label==NULL){
+        fprintf(stderr, "Components ERROR: connectedComponents(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    unionArgs A;
+    A.C = newCSRFromGraph(G);
+    int n = A.C->n;
+    A.parent = malloc((n+1)*sizeof(atomic_int));
+    A.root = malloc((n+1)*sizeof(int));
+    assert(A.parent!=NULL && A.root!=NULL && "ERROR: connectedComponents(): out of memory");
+    for(int u = 0; u<=n; u++){
+        atomic_init(&A.parent[u], u);
+    }
+    parallelRun(threads, uniteTask, &A);
+    parallelRun(threads, rootTask, &A);
+
+    // a root is the smallest vertex of its tree, so it is labeled first
+    int k = 0;
+    for(int u = 1; u<=n; u++){
+        label[u] = (A.root[u]==u) ? ++k : label[A.root[u]];
+    }
+    if(size!=NULL){
+        for(int c = 1; c<=k; c++){
+            size[c] = 0;
+        }
+        for(int u = 1; u<=n; u++){
+            size[label[u]]++;
+        }
+    }
+
+    free(A.parent);
+    free(A.root);
+    freeCSR(&A.C);
+    return k;
+}
@@ -0,0 +1,38 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Components.h
+ * Header file for graph component functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// stronglyConnectedComponents()
+// Labels the strongly connected components of G, treating every edge from
+// addEdge() as a pair of arcs. Sets comp[u] for 1 <= u <= getOrder(G) to a
+// component number in 1..k and returns k. Components are numbered in
+// topological order, so every arc u -> v with comp[u] != comp[v] has
+// comp[u] < comp[v]. Uses an explicit stack instead of recursion.
+// Pre: comp has room for getOrder(G)+1 ints
+int stronglyConnectedComponents(Graph G, int* comp);
+
+// condensation()
+// Returns the condensation DAG of G for the k components in comp: a Graph on
+// k vertices with a single arc c -> d whenever some arc of G leads from
+// component c to component d != c. Adjacency lists are sorted.
+// Pre: comp was filled in by stronglyConnectedComponents(G, comp)
+Graph condensation(Graph G, const int* comp, int k);
+
+// connectedComponents()
+// Labels the connected components of G, treating every arc as an undirected
+// edge. Sets label[u] for 1 <= u <= getOrder(G) to a component number in
+// 1..k, numbered in order of their smallest vertex, and returns k. If size is
+// not NULL, size[c] is set to the number of vertices in component c. Runs a
+// concurrent union-find over the arcs on threads worker threads.
+// Pre: label and size have room for getOrder(G)+1 ints
+int connectedComponents(Graph G, int* label, int* size, int threads);
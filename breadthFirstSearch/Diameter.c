@@ -0,0 +1,137 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Diameter.c
+ * Definition of Diameter.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+#include "Diameter.h"
+
+// boundSweeps()
+// Runs at most sweeps BFS() searches on G, narrowing lower[] and upper[] by
+// the distances d(v, w) from each searched vertex v: ecc(w) is at least
+// max(d(v, w), ecc(v) - d(v, w)) and at most ecc(v) + d(v, w). The first
+// search is from vertex 1, the second from the vertex farthest from it, and
+// after that the searches alternate between the candidate with the largest
+// upper bound and the one with the smallest lower bound. A vertex stops being
+// a candidate when its bounds meet, or, if diameter is true, when its upper
+// bound cannot beat the largest eccentricity found. Returns that largest
+// eccentricity.
+static int boundSweeps(Graph G, int* lower, int* upper, int sweeps, bool diameter){
+    int n = getOrder(G);
+    int* cand = malloc(n*sizeof(int));
+    assert(cand!=NULL && "ERROR: boundSweeps(): out of memory");
+    for(int u = 1; u<=n; u++){
+        lower[u] = 0;
+        upper[u] = n-1;
+        cand[u-1] = u;
+    }
+    int count = n, best = 0, far = 1;
+    for(int round = 0; round<sweeps && count>0; round++){
+        int v;
+        if(round==0){
+            v = 1;
+        }else if(round==1 && lower[far]<upper[far] && !(diameter && upper[far]<=best)){
+            v = far;
+        }else{
+            int pick = 0;
+            for(int i = 1; i<count; i++){
+                int w = cand[i], p = cand[pick];
+                if(round%2==0 ? upper[w]>upper[p] : lower[w]<lower[p]){
+                    pick = i;
+                }
+            }
+            v = cand[pick];
+        }
+
+        BFS(G, v);
+        int ecc = 0;
+        for(int w = 1; w<=n; w++){
+            if(getDist(G, w)>ecc){
+                ecc = getDist(G, w);
+                far = w;
+            }
+        }
+        if(ecc>best){
+            best = ecc;
+        }
+        for(int w = 1; w<=n; w++){
+            int d = getDist(G, w);
+            if(d<0){
+                continue;
+            }
+            int lo = (d>ecc-d) ? d : ecc-d;
+            if(lo>lower[w]){
+                lower[w] = lo;
+            }
+            if(ecc+d<upper[w]){
+                upper[w] = ecc+d;
+            }
+        }
+
+        int kept = 0;
+        for(int i = 0; i<count; i++){
+            int w = cand[i];
+            bool done = lower[w]==upper[w] || (diameter && upper[w]<=best);
+            if(!done){
+                cand[kept++] = w;
+            }
+        }
+        count = kept;
+    }
+    free(cand);
+    return best;
+}
+
+// graphDiameter()
+// Returns the diameter of G: the largest distance between two vertices that
+// can reach each other. Starts with a double sweep and then bounds every
+// eccentricity from the BFS() runs so far (Takes-Kosters), searching only
+// from vertices that could still raise the diameter. Usually needs a few
+// dozen BFS() runs instead of one per vertex. G is left as after BFS() from
+// the last vertex searched.
+// Pre: every edge of G was added with addEdge()
+int graphDiameter(Graph G){
+    if (G==NULL){
+        fprintf(stderr, "Diameter ERROR: graphDiameter(): NULL Graph\n");
+        exit(EXIT_FAILURE);
+    }
+    int n = getOrder(G);
+    int* lower = malloc((n+1)*sizeof(int));
+    int* upper = malloc((n+1)*sizeof(int));
+    assert(lower!=NULL && upper!=NULL && "ERROR: graphDiameter(): out of memory");
+    int d = boundSweeps(G, lower, upper, n, true);
+    free(lower);
+    free(upper);
+    return d;
+}
+
+// eccentricityBounds()
+// Sets lower[u] <= ecc(u) <= upper[u] for 1 <= u <= getOrder(G), ecc(u)
+// being the largest distance from u to a vertex it can reach, using at most
+// sweeps BFS() runs. Returns the number of vertices whose eccentricity is
+// known exactly, that is with lower[u] == upper[u]. A vertex is only searched
+// from while its bounds differ, so enough sweeps give every eccentricity.
+// G is left as after BFS() from the last vertex searched.
+// Pre: every edge of G was added with addEdge(), lower and upper have room
+// for getOrder(G)+1 ints
+int eccentricityBounds(Graph G, int* lower, int* upper, int sweeps){
+    if (G==NULL || lower==NULL || upper==NULL){
+        fprintf(stderr, "Diameter ERROR: eccentricityBounds(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    boundSweeps(G, lower, upper, sweeps, false);
+    int exact = 0;
+    for(int u = 1; u<=getOrder(G); u++){
+        if(lower[u]==upper[u]){
+            exact++;
+        }
+    }
+    return exact;
+}
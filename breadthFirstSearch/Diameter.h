@@ -0,0 +1,34 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Diameter.h
+ * Header file for diameter and eccentricity functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// graphDiameter()
+// Returns the diameter of G: the largest distance between two vertices that
+// can reach each other. Starts with a double sweep and then bounds every
+// eccentricity from the BFS() runs so far (Takes-Kosters), searching only
+// from vertices that could still raise the diameter. Usually needs a few
+// dozen BFS() runs instead of one per vertex. G is left as after BFS() from
+// the last vertex searched.
+// Pre: every edge of G was added with addEdge()
+int graphDiameter(Graph G);
+
+// eccentricityBounds()
+// Sets lower[u] <= ecc(u) <= upper[u] for 1 <= u <= getOrder(G), ecc(u)
+// being the largest distance from u to a vertex it can reach, using at most
+// sweeps BFS() runs. Returns the number of vertices whose eccentricity is
+// known exactly, that is with lower[u] == upper[u]. A vertex is only searched
+// from while its bounds differ, so enough sweeps give every eccentricity.
+// G is left as after BFS() from the last vertex searched.
+// Pre: every edge of G was added with addEdge(), lower and upper have room
+// for getOrder(G)+1 ints
+int eccentricityBounds(Graph G, int* lower, int* upper, int sweeps);
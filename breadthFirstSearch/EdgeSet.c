@@ -0,0 +1,183 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * EdgeSet.c
+ * Definition of EdgeSet.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "EdgeSet.h"
+
+#define EMPTY 0
+#define MIN_CAPACITY 16
+
+typedef struct EdgeSetObj{
+    int n;
+    int size;
+    long capacity;          // always a power of 2
+    long long* slot;        // arc key or EMPTY
+} EdgeSetObj;
+
+// key()
+// Returns the key of the arc u -> v. Keys start at n+2, so never EMPTY.
+static long long key(EdgeSet S, int u, int v){
+    return (long long)u*(S->n+1) + v;
+}
+
+// hash()
+// Returns the home slot of key k, mixing the bits so that the consecutive
+// keys of one vertex's arcs are spread over the table.
+static long hash(EdgeSet S, long long k){
+    unsigned long long x = (unsigned long long)k;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (long)(x & (unsigned long long)(S->capacity-1));
+}
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newEdgeSet()
+// Returns an empty set for arcs between vertices 1..n.
+EdgeSet newEdgeSet(int n){
+    EdgeSet S = malloc(sizeof(EdgeSetObj));
+    assert(S!=NULL && "ERROR: newEdgeSet(): out of memory");
+    S->n = n;
+    S->size = 0;
+    S->capacity = MIN_CAPACITY;
+    S->slot = calloc(S->capacity, sizeof(long long));
+    assert(S->slot!=NULL && "ERROR: newEdgeSet(): out of memory");
+    return S;
+}
+
+// freeEdgeSet()
+// Frees heap memory associated with *pS, sets *pS to NULL.
+void freeEdgeSet(EdgeSet* pS){
+    if (pS!=NULL && *pS!=NULL){
+        free((*pS)->slot);
+        free(*pS);
+        *pS = NULL;
+    }
+}
+
+// Access functions -----------------------------------------------------------
+
+// edgeSetSize()
+// Returns the number of arcs in S.
+int edgeSetSize(EdgeSet S){
+    if (S==NULL){
+        fprintf(stderr, "EdgeSet Error: edgeSetSize(): NULL EdgeSet reference\n");
+        exit(EXIT_FAILURE);
+    }
+    return S->size;
+}
+
+// find()
+// Returns the slot holding key k, or the empty slot where it would go.
+static long find(EdgeSet S, long long k){
+    long mask = S->capacity-1;
+    long i = hash(S, k);
+    while (S->slot[i]!=EMPTY && S->slot[i]!=k){
+        i = (i+1) & mask;
+    }
+    return i;
+}
+
+// edgeSetContains()
+// Returns true if the arc u -> v is in S.
+bool edgeSetContains(EdgeSet S, int u, int v){
+    if (S==NULL){
+        fprintf(stderr, "EdgeSet Error: edgeSetContains(): NULL EdgeSet reference\n");
+        exit(EXIT_FAILURE);
+    }
+    long long k = key(S, u, v);
+    return S->slot[find(S, k)]==k;
+}
+
+// Manipulation procedures ----------------------------------------------------
+
+// grow()
+// Doubles the table of S and reinserts every key.
+static void grow(EdgeSet S){
+    long long* old = S->slot;
+    long oldCapacity = S->capacity;
+    S->capacity *= 2;
+    S->slot = calloc(S->capacity, sizeof(long long));
+    assert(S->slot!=NULL && "ERROR: edgeSetInsert(): out of memory");
+    for (long i = 0; i<oldCapacity; i++){
+        if (old[i]!=EMPTY){
+            S->slot[find(S, old[i])] = old[i];
+        }
+    }
+    free(old);
+}
+
+// edgeSetInsert()
+// Adds the arc u -> v to S. Returns true if it was not already there.
+// Pre: 1 <= u <= n, 1 <= v <= n
+bool edgeSetInsert(EdgeSet S, int u, int v){
+    if (S==NULL){
+        fprintf(stderr, "EdgeSet Error: edgeSetInsert(): NULL EdgeSet reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (u<1 || u>S->n || v<1 || v>S->n){
+        fprintf(stderr, "EdgeSet Error: edgeSetInsert(): vertex out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    long long k = key(S, u, v);
+    long i = find(S, k);
+    if (S->slot[i]==k){
+        return false;
+    }
+    S->slot[i] = k;
+    S->size++;
+    if (2L*S->size > S->capacity){
+        grow(S);
+    }
+    return true;
+}
+
+// edgeSetRemove()
+// Removes the arc u -> v from S. Returns true if it was there. The keys after
+// the freed slot are shifted back so no probe sequence is broken.
+bool edgeSetRemove(EdgeSet S, int u, int v){
+    if (S==NULL){
+        fprintf(stderr, "EdgeSet Error: edgeSetRemove(): NULL EdgeSet reference\n");
+        exit(EXIT_FAILURE);
+    }
+    long mask = S->capacity-1;
+    long i = find(S, key(S, u, v));
+    if (S->slot[i]==EMPTY){
+        return false;
+    }
+    S->slot[i] = EMPTY;
+    S->size--;
+    for (long j = (i+1) & mask; S->slot[j]!=EMPTY; j = (j+1) & mask){
+        long h = hash(S, S->slot[j]);
+        // the key at j may move to i unless its home lies cyclically in (i, j]
+        bool stay = (i<j) ? (i<h && h<=j) : (i<h || h<=j);
+        if (!stay){
+            S->slot[i] = S->slot[j];
+            S->slot[j] = EMPTY;
+            i = j;
+        }
+    }
+    return true;
+}
+
+// edgeSetClear()
+// Removes every arc from S.
+void edgeSetClear(EdgeSet S){
+    if (S==NULL){
+        fprintf(stderr, "EdgeSet Error: edgeSetClear(): NULL EdgeSet reference\n");
+        exit(EXIT_FAILURE);
+    }
+    for (long i = 0; i<S->capacity; i++){
+        S->slot[i] = EMPTY;
+    }
+    S->size = 0;
+}
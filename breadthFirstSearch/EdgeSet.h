@@ -0,0 +1,58 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * EdgeSet.h
+ * Header file for the open addressing edge hash set
+ ***/
+
+#ifndef EDGESET_H
+#define EDGESET_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+// Exported Types -------------------------------------------------------------
+
+// A set of arcs u -> v between vertices 1..n, kept in a linear probing hash
+// table that doubles whenever it becomes half full.
+typedef struct EdgeSetObj* EdgeSet;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newEdgeSet()
+// Returns an empty set for arcs between vertices 1..n.
+EdgeSet newEdgeSet(int n);
+
+// freeEdgeSet()
+// Frees heap memory associated with *pS, sets *pS to NULL.
+void freeEdgeSet(EdgeSet* pS);
+
+// Access functions -----------------------------------------------------------
+
+// edgeSetSize()
+// Returns the number of arcs in S.
+int edgeSetSize(EdgeSet S);
+
+// edgeSetContains()
+// Returns true if the arc u -> v is in S.
+bool edgeSetContains(EdgeSet S, int u, int v);
+
+// Manipulation procedures ----------------------------------------------------
+
+// edgeSetInsert()
+// Adds the arc u -> v to S. Returns true if it was not already there.
+// Pre: 1 <= u <= n, 1 <= v <= n
+bool edgeSetInsert(EdgeSet S, int u, int v);
+
+// edgeSetRemove()
+// Removes the arc u -> v from S. Returns true if it was there.
+bool edgeSetRemove(EdgeSet S, int u, int v);
+
+// edgeSetClear()
+// Removes every arc from S.
+void edgeSetClear(EdgeSet S);
+
+#endif
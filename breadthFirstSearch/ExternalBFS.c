@@ -0,0 +1,274 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * ExternalBFS.c
+ * Definition of ExternalBFS.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "ExternalBFS.h"
+
+// Runs are merged at most MAX_FANIN at a time, so that the number of open
+// scratch files stays small.
+#define MAX_FANIN 16
+
+// The smallest run buffer, in ints, whatever the memory budget.
+#define MIN_BUFFER 16
+
+// A sorted file of ints read one at a time.
+typedef struct stream{
+    FILE* f;
+    int head;       // the next int, valid while more is true
+    bool more;
+} stream;
+
+// writeGraphFile()
+// Writes the adjacency of G to the binary file out for externalBFS(): the
+// ints n and m, the n+2 offsets of a CSR on the vertex numbers, then its m
+// neighbors, all in native byte order. Returns false on a write error.
+bool writeGraphFile(Graph G, FILE* out){
+    if (G==NULL || out==NULL){
+        fprintf(stderr, "ExternalBFS ERROR: writeGraphFile(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    CSR C = newCSRFromGraph(G);
+    int size[2] = {C->n, C->offset[C->n+1]};
+    bool ok = fwrite(size, sizeof(int), 2, out)==2
+           && fwrite(C->offset, sizeof(int), C->n+2, out)==(size_t)C->n+2
+           && fwrite(C->nbr, sizeof(int), size[1], out)==(size_t)size[1];
+    freeCSR(&C);
+    return ok && fflush(out)==0;
+}
+
+// scratchFile()
+// Returns a new empty scratch file.
+static FILE* scratchFile(void){
+    FILE* f = tmpfile();
+    if(f==NULL){
+        fprintf(stderr, "ExternalBFS ERROR: externalBFS(): could not create a scratch file\n");
+        exit(EXIT_FAILURE);
+    }
+    return f;
+}
+
+// readInts()
+// Reads k ints at index i of the graph file in into A.
+static void readInts(FILE* in, long i, int* A, int k){
+    if(fseek(in, i*(long)sizeof(int), SEEK_SET)!=0 || fread(A, sizeof(int), k, in)!=(size_t)k){
+        fprintf(stderr, "ExternalBFS ERROR: externalBFS(): truncated graph file\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// writeInts()
+// Writes the k ints of A to the file f.
+static void writeInts(FILE* f, const int* A, int k){
+    if(fwrite(A, sizeof(int), k, f)!=(size_t)k){
+        fprintf(stderr, "ExternalBFS ERROR: externalBFS(): write failed\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// openStream()
+// Starts reading the sorted file f from its beginning.
+static void openStream(stream* S, FILE* f){
+    rewind(f);
+    S->f = f;
+    S->more = fread(&S->head, sizeof(int), 1, f)==1;
+}
+
+// advance()
+// Moves S on to its next int.
+static void advance(stream* S){
+    S->more = fread(&S->head, sizeof(int), 1, S->f)==1;
+}
+
+// compareInt()
+// qsort() comparison for ints.
+static int compareInt(const void* a, const void* b){
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x>y)-(x<y);
+}
+
+// flushRun()
+// Sorts the k ints of buf, drops repeats and writes them to a new run,
+// which is added to runs. Returns the new number of runs.
+static int flushRun(int* buf, int k, FILE*** runs, int count, int* capacity){
+    qsort(buf, k, sizeof(int), compareInt);
+    int j = 0;
+    for(int i = 0; i<k; i++){
+        if(j==0 || buf[i]!=buf[j-1]){
+            buf[j++] = buf[i];
+        }
+    }
+    FILE* f = scratchFile();
+    writeInts(f, buf, j);
+    if(count==*capacity){
+        *capacity *= 2;
+        *runs = realloc(*runs, *capacity*sizeof(FILE*));
+        assert(*runs!=NULL && "ERROR: externalBFS(): out of memory");
+    }
+    (*runs)[count] = f;
+    return count+1;
+}
+
+// mergeRuns()
+// Merges the k sorted runs R[0..k-1] into one new sorted run without
+// repeats, and closes them.
+static FILE* mergeRuns(FILE** R, int k){
+    stream S[MAX_FANIN];
+    for(int i = 0; i<k; i++){
+        openStream(&S[i], R[i]);
+    }
+    FILE* f = scratchFile();
+    bool any = false;
+    int last = 0;
+    for(;;){
+        int min = -1;
+        for(int i = 0; i<k; i++){
+            if(S[i].more && (min<0 || S[i].head<S[min].head)){
+                min = i;
+            }
+        }
+        if(min<0){
+            break;
+        }
+        int x = S[min].head;
+        advance(&S[min]);
+        if(!any || x!=last){
+            writeInts(f, &x, 1);
+            any = true;
+            last = x;
+        }
+    }
+    for(int i = 0; i<k; i++){
+        fclose(R[i]);
+    }
+    return f;
+}
+
+// externalBFS()
+// Runs BFS from s on the graph stored in the file in (see writeGraphFile())
+// without loading it, in the style of Munagala and Ranade. Each level is a
+// sorted file of vertices. The neighbors of a level are read from in, sorted
+// in runs of at most memory bytes and merged into one sorted set, and the
+// vertices of the two levels before it are merged out of that set to give
+// the next level. Writes every reached vertex u as the pair of ints u and
+// its distance to out, level by level and in increasing order within a
+// level, and returns the number of vertices reached. Scratch files come from
+// tmpfile() and are removed as soon as they are closed.
+// Pre: in holds an undirected graph (every edge added with addEdge()),
+// 1 <= s <= n, in is open for reading and out for writing in binary
+long externalBFS(FILE* in, int s, FILE* out, long memory){
+    if (in==NULL || out==NULL){
+        fprintf(stderr, "ExternalBFS ERROR: externalBFS(): NULL file\n");
+        exit(EXIT_FAILURE);
+    }
+    int size[2];
+    readInts(in, 0, size, 2);
+    int n = size[0];
+    if(s<1 || s>n){
+        fprintf(stderr, "ExternalBFS ERROR: externalBFS(): invalid source vertex\n");
+        exit(EXIT_FAILURE);
+    }
+    long nbrStart = 2L+n+2;     // index of the first neighbor in the file
+    long cap = memory/(long)sizeof(int);
+    if(cap<MIN_BUFFER){
+        cap = MIN_BUFFER;
+    }
+    int fanin = (int)(memory/BUFSIZ);
+    fanin = (fanin<2) ? 2 : (fanin>MAX_FANIN) ? MAX_FANIN : fanin;
+    int* buf = malloc(cap*sizeof(int));
+    int capacity = MAX_FANIN;
+    FILE** runs = malloc(capacity*sizeof(FILE*));
+    assert(buf!=NULL && runs!=NULL && "ERROR: externalBFS(): out of memory");
+
+    FILE* older = scratchFile();    // level d-1
+    FILE* level = scratchFile();    // level d
+    writeInts(level, &s, 1);
+    int pair[2] = {s, 0};
+    writeInts(out, pair, 2);
+    long reached = 1;
+
+    for(int d = 1; ; d++){
+        // sort the neighbors of level d-1 in runs of at most cap ints
+        int count = 0;
+        long k = 0;
+        stream L;
+        for(openStream(&L, level); L.more; advance(&L)){
+            int off[2];
+            readInts(in, 2L+L.head, off, 2);
+            long i = off[0];
+            while(i<off[1]){
+                if(k==cap){
+                    count = flushRun(buf, (int)k, &runs, count, &capacity);
+                    k = 0;
+                }
+                long take = (off[1]-i<cap-k) ? off[1]-i : cap-k;
+                readInts(in, nbrStart+i, buf+k, (int)take);
+                k += take;
+                i += take;
+            }
+        }
+        if(k>0 || count==0){
+            count = flushRun(buf, (int)k, &runs, count, &capacity);
+        }
+        // merge the runs fanin at a time until one is left
+        while(count>1){
+            int merged = 0;
+            for(int i = 0; i<count; i += fanin){
+                int j = (count-i<fanin) ? count-i : fanin;
+                runs[merged++] = mergeRuns(runs+i, j);
+            }
+            count = merged;
+        }
+        FILE* candidates = runs[0];
+
+        // the next level is every neighbor not in the two levels before it;
+        // in an undirected graph no other earlier vertex can be a neighbor
+        FILE* next = scratchFile();
+        stream A, B, C;
+        openStream(&A, candidates);
+        openStream(&B, level);
+        openStream(&C, older);
+        bool empty = true;
+        for(; A.more; advance(&A)){
+            int x = A.head;
+            while(B.more && B.head<x){
+                advance(&B);
+            }
+            while(C.more && C.head<x){
+                advance(&C);
+            }
+            if((B.more && B.head==x) || (C.more && C.head==x)){
+                continue;
+            }
+            writeInts(next, &x, 1);
+            pair[0] = x;
+            pair[1] = d;
+            writeInts(out, pair, 2);
+            reached++;
+            empty = false;
+        }
+        fclose(candidates);
+        fclose(older);
+        older = level;
+        level = next;
+        if(empty){
+            break;
+        }
+    }
+
+    fclose(older);
+    fclose(level);
+    free(buf);
+    free(runs);
+    fflush(out);
+    return reached;
+}
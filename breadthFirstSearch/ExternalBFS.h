@@ -0,0 +1,33 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * ExternalBFS.h
+ * Header file for external memory BFS functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// writeGraphFile()
+// Writes the adjacency of G to the binary file out for externalBFS(): the
+// ints n and m, the n+2 offsets of a CSR on the vertex numbers, then its m
+// neighbors, all in native byte order. Returns false on a write error.
+bool writeGraphFile(Graph G, FILE* out);
+
+// externalBFS()
+// Runs BFS from s on the graph stored in the file in (see writeGraphFile())
+// without loading it, in the style of Munagala and Ranade. Each level is a
+// sorted file of vertices. The neighbors of a level are read from in, sorted
+// in runs of at most memory bytes and merged into one sorted set, and the
+// vertices of the two levels before it are merged out of that set to give
+// the next level. Writes every reached vertex u as the pair of ints u and
+// its distance to out, level by level and in increasing order within a
+// level, and returns the number of vertices reached. Scratch files come from
+// tmpfile() and are removed as soon as they are closed.
+// Pre: in holds an undirected graph (every edge added with addEdge()),
+// 1 <= s <= n, in is open for reading and out for writing in binary
+long externalBFS(FILE* in, int s, FILE* out, long memory);
@@ -8,6 +8,9 @@
 
 #include <stdio.h>
 #include<stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
 #include "List.h"
 #include "Graph.h"
 
@@ -17,7 +20,28 @@
 #define INF -1
 #define NIL -2
 
+// worker threads for the -m distance matrix
+#define MATRIX_THREADS 4
+
+// FindPath [-m csv|bin] infile outfile
+// With -m the queries u v are not answered one by one. Instead the distances
+// from every distinct u to every distinct v, each in order of first use, are
+// written as a CSV or binary matrix (see printMatrix()) in place of the usual
+// output.
 int main(int fileCheck, char* fileRead[]){
+    bool matrix = false;
+    bool binary = false;
+    if (fileCheck == 5 && strcmp(fileRead[1], "-m") == 0){
+        matrix = true;
+        if (strcmp(fileRead[2], "bin") == 0){
+            binary = true;
+        }else if (strcmp(fileRead[2], "csv") != 0){
+            fprintf(stderr, "Unknown matrix format %s, use csv or bin\n", fileRead[2]);
+            exit(EXIT_FAILURE);
+        }
+        fileCheck -= 2;
+        fileRead += 2;
+    }
     if (fileCheck != 3){
         fprintf(stderr, "Incorrect number of command line arguments\n");
         exit(EXIT_FAILURE);
@@ -29,7 +53,7 @@ int main(int fileCheck, char* fileRead[]){
         exit(EXIT_FAILURE);
     }
 
-    FILE* closeFile = fopen(fileRead[2], "w");
+    FILE* closeFile = fopen(fileRead[2], binary ? "wb" : "w");
     if (closeFile == NULL){
         fprintf(stderr, "Error: NULL file 2");
         exit(EXIT_FAILURE);
@@ -37,16 +61,66 @@ int main(int fileCheck, char* fileRead[]){
 
     int n;
     fscanf(openFile,"%d",&n);
-    Graph G = newGraph(n);
 
+    // read the edge pairs into one buffer and build the graph from it
+    int m = 0;
+    int cap = 64;
+    int* edges = malloc(2*cap*sizeof(int));
+    assert(edges!=NULL && "ERROR: main(): out of memory");
     int u;
     int v;
     while(fscanf(openFile,"%d%d",&u,&v)==2){
         if(u==0&&v==0){
             break;
-        }else{
-            addEdge(G,u,v);
         }
+        if(m==cap){
+            cap *= 2;
+            edges = realloc(edges, 2*cap*sizeof(int));
+            assert(edges!=NULL && "ERROR: main(): out of memory");
+        }
+        edges[2*m] = u;
+        edges[2*m+1] = v;
+        m++;
+    }
+    Graph G = newGraphFromEdges(n, edges, m, 0, 1);
+    free(edges);
+    int* path = NULL;
+
+    if (matrix){
+        int* S = malloc((n+1)*sizeof(int));
+        int* T = malloc((n+1)*sizeof(int));
+        bool* inS = calloc(n+1, sizeof(bool));
+        bool* inT = calloc(n+1, sizeof(bool));
+        assert(S!=NULL && T!=NULL && inS!=NULL && inT!=NULL && "ERROR: main(): out of memory");
+        int ns = 0;
+        int nt = 0;
+        while(fscanf(openFile,"%d%d",&u,&v)==2 && !(u==0&&v==0)){
+            if (u<1 || u>n || v<1 || v>n){
+                fprintf(stderr, "Error: query %d %d out of range\n", u, v);
+                exit(EXIT_FAILURE);
+            }
+            if (!inS[u]){
+                inS[u] = true;
+                S[ns++] = u;
+            }
+            if (!inT[v]){
+                inT[v] = true;
+                T[nt++] = v;
+            }
+        }
+        int* M = malloc(((long)ns*nt+1)*sizeof(int));
+        assert(M!=NULL && "ERROR: main(): out of memory");
+        distanceMatrix(G, S, ns, T, nt, M, MATRIX_THREADS);
+        printMatrix(closeFile, M, ns, nt, binary);
+        free(M);
+        free(S);
+        free(T);
+        free(inS);
+        free(inT);
+        freeGraph(&G);
+        fclose(openFile);
+        fclose(closeFile);
+        return 0;
     }
 
     printGraph(closeFile,G);
@@ -56,7 +130,7 @@ int main(int fileCheck, char* fileRead[]){
         if(u==0&&v==0){
             break;
         }else{
-            BFS(G,u);
+            BFSTo(G,u,v);
             int dist = getDist(G,v);
             if(dist==INF){
                 fprintf(closeFile, "The distance from %d to %d is infinity\n", u,v);
@@ -66,13 +140,11 @@ int main(int fileCheck, char* fileRead[]){
                 getPath(P,G,v);
                 fprintf(closeFile, "The distance from %d to %d is %d\n", u,v,dist);
                 fprintf(closeFile, "A shortest %d-%d path is:(",u,v);
-                for (moveFront(P); position(P)>=0; moveNext(P)){
-                    int x = get(P);
-                    fprintf(closeFile, "%d", x);
-                    if(position(P)<length(P)-1){
-                        fprintf(closeFile, ", ");
-                    }
-                    
+                path = realloc(path, (dist+1)*sizeof(int));
+                assert(path!=NULL && "ERROR: main(): out of memory");
+                int k = toArray(P, path);
+                for (int i = 0; i<k; i++){
+                    fprintf(closeFile, (i>0) ? ", %d" : "%d", path[i]);
                 }
                 fprintf(closeFile,")\n\n");
                 freeList(&P);
@@ -80,6 +152,7 @@ int main(int fileCheck, char* fileRead[]){
         }
     }
 
+    free(path);
     freeGraph(&G);
     fclose(openFile);
     fclose(closeFile);
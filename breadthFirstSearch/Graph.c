@@ -12,8 +12,14 @@
 #include <stdbool.h>
 #include <assert.h>
 #include <math.h>
+#include <limits.h>
+#include <stdatomic.h>
 #include "List.h"
 #include "Graph.h"
+#include "CSR.h"
+#include "Parallel.h"
+#include "EdgeSet.h"
+#include "Heap.h"
 
 #define white 0
 #define grey 1
@@ -21,6 +27,16 @@
 #define INF -1
 #define NIL -2
 
+// A removed neighbor y stays in its adjacency list as the tombstone -y until
+// the list is compacted, which happens once more than 1/COMPACT_FRACTION of
+// the list is dead.
+#define COMPACT_FRACTION 4
+
+// In hybrid mode the neighbors of x are its frozen range of base followed by
+// the delta list adjacency[x]. The deltas are folded into a new base once
+// the changes since the last merge pass 1/MERGE_FRACTION of the graph.
+#define MERGE_FRACTION 8
+
 
  typedef struct GraphObj{
     int vertices;
@@ -30,8 +46,63 @@
     int* parent;
     int* distance;
     List* adjacency;
+    int* label;     // label[x] is the vertex number of internal vertex x
+    int* index;     // index[u] is the internal vertex of vertex number u
+    bool incremental;
+    int* queue;     // scratch queue for searches that must not allocate
+    EdgeSet dedup;  // arcs by vertex number, NULL unless setDedup() is on
+    int* dead;      // dead[x] is the number of tombstones in adjacency[x]
+    CSR base;       // frozen neighbors by internal vertex, NULL unless hybrid
+    int churn;      // insertions and base removals since the last merge
+    List* weight;   // weight[x] parallels adjacency[x], NULL while unweighted
+    bool weighted;  // the search results come from Dijkstra()
+    CSR transpose;  // in-neighbors by internal vertex, NULL until needed
+    bool reversed;  // the search results come from BFSReverse()
+    int target;     // target of BFSTo(), NIL after any other search
+    bool partial;   // BFSTo() stopped before every vertex was reached
+    int touched;    // queue[0..touched) are all BFSTo() must reset, -1 for all
+    int* stamp;     // stamp[x] == epoch if a bounded search has seen x
+    int epoch;
  } GraphObj;
 
+typedef struct BFSContextObj{
+    Graph G;
+    int* dist;      // dist[x] is 1 more than the distance to x, 0 if unreached
+    int* parent;    // parent[x] is the parent of x, 0 if none
+    int* queue;     // queue[head..tail) still have neighbors to scan
+    int head;
+    int tail;
+    int next;       // the next neighbor of queue[head] to scan
+    int* nbr;       // copy of the adjacency List of queue[head] if loaded
+    int capacity;   // room in nbr
+    bool loaded;
+    bool done;
+} BFSContextObj;
+
+// toInternal()
+// Returns the internal vertex that stores vertex number u.
+static int toInternal(Graph G, int u){
+    return (G->index==NULL) ? u : G->index[u];
+}
+
+// toExternal()
+// Returns the vertex number of internal vertex x. NIL is passed through.
+static int toExternal(Graph G, int x){
+    return (G->label==NULL || x<1) ? x : G->label[x];
+}
+
+// baseRange()
+// Sets [*lo, *hi) to the range of base holding the frozen neighbors of
+// internal vertex x, or to an empty range if G is not in hybrid mode.
+static void baseRange(Graph G, int x, int* lo, int* hi){
+    if(G->base==NULL){
+        *lo = *hi = 0;
+    }else{
+        *lo = G->base->offset[x];
+        *hi = G->base->offset[x+1];
+    }
+}
+
 
 // constructors - destructors -------------------------------------------------
 
@@ -44,6 +115,22 @@ Graph newGraph(int n){
     G->vertices = n;
     G->edges = 0;
     G->source = NIL;
+    G->label = NULL;
+    G->index = NULL;
+    G->incremental = false;
+    G->queue = NULL;
+    G->dedup = NULL;
+    G->base = NULL;
+    G->churn = 0;
+    G->weight = NULL;
+    G->weighted = false;
+    G->transpose = NULL;
+    G->reversed = false;
+    G->target = NIL;
+    G->partial = false;
+    G->touched = 0;
+    G->stamp = NULL;
+    G->epoch = 0;
 
     G->adjacency = calloc(n+1, sizeof(List));
     assert(G->adjacency!=NULL && "ERROR: newGraph: NULL Graph (adjacency list)");
@@ -55,6 +142,8 @@ Graph newGraph(int n){
     G->color = calloc(n+1, sizeof(int));
     G->parent = calloc(n+1, sizeof(int));
     G->distance = calloc(n+1, sizeof(int));
+    G->dead = calloc(n+1, sizeof(int));
+    assert(G->dead!=NULL && "ERROR: newGraph(): out of memory");
 
     for(int i =1; i<=n;i++){
        G->color[i] = white;
@@ -65,6 +154,66 @@ Graph newGraph(int n){
     return G;
 }
 
+typedef struct fillArgs{
+    Graph G;
+    CSR C;
+} fillArgs;
+
+// fillTask()
+// Copies this thread's block of CSR neighbor ranges into adjacency lists.
+static void fillTask(int id, int threads, void* p){
+    Graph G = ((fillArgs*)p)->G;
+    CSR C = ((fillArgs*)p)->C;
+    int lo = chunkStart(1, G->vertices+1, id, threads);
+    int hi = chunkStart(1, G->vertices+1, id+1, threads);
+    for(int u = lo; u<hi; u++){
+        appendArray(G->adjacency[u], C->nbr+C->offset[u], C->offset[u+1]-C->offset[u]);
+    }
+}
+
+// newGraphFromEdges()
+// Returns a Graph having n vertices and the m edges stored as pairs in
+// edges[0..2m-1]. The edges are undirected as with addEdge() unless flags
+// contains BUILD_DIRECTED, in which case they are arcs as with addArc().
+// BUILD_SORT sorts every adjacency list and BUILD_DEDUP also drops repeated
+// edges. Directed builds are always sorted, since addArc() inserts into a
+// sorted list. The adjacency is built on threads worker threads.
+// Pre: 1 <= edges[i] <= n
+Graph newGraphFromEdges(int n, const int* edges, int m, int flags, int threads){
+    if(n<0){
+        fprintf(stderr, "GRAPH ERROR: newGraphFromEdges(): negative order");
+        exit(EXIT_FAILURE);
+    }
+    bool directed = (flags & BUILD_DIRECTED) != 0;
+    CSR C = newCSRFromEdges(n, edges, m, directed, threads);
+    if(directed || (flags & (BUILD_SORT|BUILD_DEDUP))){
+        sortCSR(C, (flags & BUILD_DEDUP) != 0, threads);
+    }
+
+    Graph G = newGraph(n);
+    fillArgs A = {G, C};
+    parallelRun(threads, fillTask, &A);
+
+    if(!(flags & BUILD_DEDUP)){
+        G->edges = m;
+    }else if(directed){
+        G->edges = C->offset[n+1];
+    }else{
+        // every undirected edge is stored twice except self loops
+        int e = 0;
+        for(int u = 1; u<=n; u++){
+            for(int i = C->offset[u]; i<C->offset[u+1]; i++){
+                if(C->nbr[i]>=u){
+                    e++;
+                }
+            }
+        }
+        G->edges = e;
+    }
+    freeCSR(&C);
+    return G;
+}
+
 // freeGraph()
 // Frees all dynamic memory associated with Graph *pG and sets *pG to NULL.
 void freeGraph(Graph* pG){
@@ -72,11 +221,23 @@ void freeGraph(Graph* pG){
         Graph G = *pG;
         for(int i =1; i<=(*pG)->vertices; i++){
             freeList(&((*pG)->adjacency[i]));
+            if(G->weight!=NULL){
+                freeList(&G->weight[i]);
+            }
         }
+        free(G->weight);
         free(G->adjacency);
         free(G->color);
         free(G->parent);
         free(G->distance);
+        free(G->label);
+        free(G->index);
+        free(G->queue);
+        freeEdgeSet(&G->dedup);
+        free(G->dead);
+        freeCSR(&G->base);
+        freeCSR(&G->transpose);
+        free(G->stamp);
         free(G);
         *pG=NULL;
     }
@@ -129,7 +290,7 @@ int getSource(Graph G){
     if(G->source == NIL){
         return NIL;
     }else{
-        return G->source;
+        return toExternal(G, G->source);
     }
 }
 
@@ -149,7 +310,7 @@ int getParent(Graph G, int u){
     if(G->source == NIL){
         return NIL;
     }else{
-        return G->parent[u];
+        return toExternal(G, G->parent[toInternal(G, u)]);
     }
 
 }
@@ -166,10 +327,164 @@ int getDist(Graph G, int u){
         fprintf(stderr,"Graph ERROR: getDist(): u is greater than getOrder(G)");
         exit(EXIT_FAILURE);
     }
+    int x = toInternal(G, u);
     if(G->source == NIL){
         return INF;
+    }else if(G->partial && G->color[x]==white){
+        return UNKNOWN;
     }else{
-        return G->distance[u];
+        return G->distance[x];
+    }
+}
+
+// exportCSR()
+// Returns a CSR copy of the live neighbors of G, with their weights if G is
+// weighted, on the vertex numbers if external is true and on the internal
+// vertices otherwise. Every neighbor range keeps its adjacency list order.
+static CSR exportCSR(Graph G, bool external){
+    int n = G->vertices;
+    int m = (G->base==NULL) ? 0 : G->base->offset[n+1];
+    for(int x = 1; x<=n; x++){
+        m += length(G->adjacency[x]);
+    }
+    CSR C = newCSR(n, m);
+    if(G->weight!=NULL){
+        C->weight = malloc((m>0 ? m : 1)*sizeof(int));
+        assert(C->weight!=NULL && "ERROR: exportCSR(): out of memory");
+    }
+    int k = 0;
+    for(int u = 1; u<=n; u++){
+        int x = external ? toInternal(G, u) : u;
+        C->offset[u] = k;
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        for(int i = lo; i<hi; i++){
+            int y = G->base->nbr[i];
+            if(y>0){
+                if(C->weight!=NULL){
+                    C->weight[k] = G->base->weight[i];
+                }
+                C->nbr[k++] = external ? toExternal(G, y) : y;
+            }
+        }
+        List L = G->adjacency[x];
+        List W = (G->weight==NULL) ? NULL : G->weight[x];
+        if(W!=NULL){
+            moveFront(W);
+        }
+        for(moveFront(L); position(L)>=0; moveNext(L)){
+            int y = get(L);
+            if(y>0){
+                if(W!=NULL){
+                    C->weight[k] = get(W);
+                }
+                C->nbr[k++] = external ? toExternal(G, y) : y;
+            }
+            if(W!=NULL){
+                moveNext(W);
+            }
+        }
+    }
+    C->offset[n+1] = k;
+    return C;
+}
+
+// newCSRFromGraph()
+// Returns a copy of the adjacency lists of G as a CSR on the vertex numbers
+// 1..getOrder(G). Every neighbor range keeps its adjacency list order, and
+// the arc weights are copied if G is weighted.
+CSR newCSRFromGraph(Graph G){
+    if (G == NULL){
+        fprintf(stderr, "Graph ERROR: newCSRFromGraph(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    return exportCSR(G, true);
+}
+
+// needTranspose()
+// Builds the in-neighbor index of G on threads worker threads if G has none.
+static void needTranspose(Graph G, int threads){
+    if(G->transpose==NULL){
+        CSR C = exportCSR(G, false);
+        G->transpose = transposeCSR(C, threads);
+        freeCSR(&C);
+    }
+}
+
+// buildTranspose()
+// Builds the in-neighbor index of G in O(n+m) time on threads worker
+// threads, unless it is built already. Any change to the arcs of G drops the
+// index, and the functions that need it rebuild it on one thread.
+void buildTranspose(Graph G, int threads){
+    if (G == NULL){
+        fprintf(stderr, "GRAPH ERROR: buildTranspose(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    needTranspose(G, threads);
+}
+
+// getInDegree()
+// Returns the number of arcs into vertex v, counting an edge from addEdge()
+// once. Pre: 1 <= v <= getOrder(G)
+int getInDegree(Graph G, int v){
+    if (G == NULL){
+        fprintf(stderr, "GRAPH ERROR: getInDegree(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1 || v>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: getInDegree(): v did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    needTranspose(G, 1);
+    int y = toInternal(G, v);
+    return G->transpose->offset[y+1]-G->transpose->offset[y];
+}
+
+// getInNeighbors()
+// Appends to List L every vertex u with an arc u -> v, once per arc.
+// Pre: 1 <= v <= getOrder(G)
+void getInNeighbors(List L, Graph G, int v){
+    if (G == NULL || L == NULL){
+        fprintf(stderr, "GRAPH ERROR: getInNeighbors(): NULL reference");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1 || v>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: getInNeighbors(): v did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    needTranspose(G, 1);
+    int y = toInternal(G, v);
+    for(int i = G->transpose->offset[y]; i<G->transpose->offset[y+1]; i++){
+        append(L, toExternal(G, G->transpose->nbr[i]));
+    }
+}
+
+// mergeBase()
+// Folds the delta lists and tombstones of G into a new frozen base, or
+// freezes the lists of G into a first base if it has none.
+static void mergeBase(Graph G){
+    CSR C = exportCSR(G, false);
+    freeCSR(&G->base);
+    for(int x = 1; x<=G->vertices; x++){
+        clear(G->adjacency[x]);
+        if(G->weight!=NULL){
+            clear(G->weight[x]);
+        }
+        G->dead[x] = 0;
+    }
+    G->base = C;
+    G->churn = 0;
+}
+
+// noteChange()
+// Counts one change to a hybrid G, merging once enough have piled up.
+static void noteChange(Graph G){
+    if(G->base==NULL){
+        return;
+    }
+    G->churn++;
+    if((long)G->churn*MERGE_FRACTION > G->base->offset[G->vertices+1]+G->vertices){
+        mergeBase(G);
     }
 }
 
@@ -189,12 +504,13 @@ void getPath(List L, Graph G, int u){
     if(getSource(G)==NIL){
         fprintf(stderr,"Graph ERROR: getPath(): getSource(G) is NIL");
     }
-    if (u==G->source){
+    int x = toInternal(G, u);
+    if (x==G->source){
         append(L,u);
-    }else if (G->parent[u]==NIL){
+    }else if (G->parent[x]==NIL){
         append(L,NIL);
     }else{
-        getPath(L,G,G->parent[u]);
+        getPath(L,G,toExternal(G, G->parent[x]));
         append(L,u);
     }
 }
@@ -211,16 +527,318 @@ void makeNull(Graph G){
     }
     for(int i =1; i<=G->vertices; i++){
         clear(G->adjacency[i]);
+        if(G->weight!=NULL){
+            clear(G->weight[i]);
+        }
+        G->dead[i]=0;
         G->color[i]=white;
         G->parent[i]=NIL;
         G->distance[i]=INF;
     }
     G->edges = 0;
     G->source = NIL;
+    G->target = NIL;
+    G->partial = false;
+    G->touched = 0;
+    freeCSR(&G->transpose);
+    if(G->dedup!=NULL){
+        edgeSetClear(G->dedup);
+    }
+    if(G->base!=NULL){
+        freeCSR(&G->base);
+        G->base = newCSR(G->vertices, 0);
+        G->churn = 0;
+    }
+}
+
+// relax()
+// Helper for repairBFS(). Queues w if the arc z -> w improves its distance,
+// and returns the new tail of the queue.
+static int relax(Graph G, int z, int w, int tail){
+    int* d = G->distance;
+    if(w>0 && (d[w]==INF || d[w]>d[z]+1)){
+        d[w] = d[z]+1;
+        G->parent[w] = z;
+        G->color[w] = black;
+        G->queue[tail++] = w;
+    }
+    return tail;
+}
+
+// repairBFS()
+// Updates the BFS tree of G after the arc x -> y was added, x and y internal.
+// If the arc shortens the path to y, a breadth first search from y revisits
+// only the vertices whose distance improves. Since that search hands out
+// distances in increasing order, each vertex is queued at most once.
+static void repairBFS(Graph G, int x, int y){
+    int* d = G->distance;
+    if(d[x]==INF || (d[y]!=INF && d[y]<=d[x]+1)){
+        return;
+    }
+    if(G->queue==NULL){
+        G->queue = malloc((G->vertices+1)*sizeof(int));
+        assert(G->queue!=NULL && "ERROR: repairBFS(): out of memory");
+    }
+    G->touched = -1;
+    int head = 0, tail = 0;
+    d[y] = d[x]+1;
+    G->parent[y] = x;
+    G->color[y] = black;
+    G->queue[tail++] = y;
+    while(head<tail){
+        int z = G->queue[head++];
+        int lo, hi;
+        baseRange(G, z, &lo, &hi);
+        for(int i = lo; i<hi; i++){
+            tail = relax(G, z, G->base->nbr[i], tail);
+        }
+        List L = G->adjacency[z];
+        for(moveFront(L); position(L)>=0; moveNext(L)){
+            tail = relax(G, z, get(L), tail);
+        }
+    }
+}
+
+// setIncremental()
+// If on is true, addEdge() and addArc() repair the tree of the most recent
+// BFS() so getParent(), getDist() and getPath() stay valid without another
+// call to BFS(). Only distances the new edge can improve are revisited. After
+// Dijkstra() the search is run again whenever a new arc shortens a path.
+void setIncremental(Graph G, bool on){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: setIncremental(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    G->incremental = on;
+}
+
+// setDedup()
+// If on is true, addEdge() and addArc() ignore edges already in G, checked
+// through a hash set of arcs, and getNumEdges() counts only distinct edges.
+// Duplicates already in G when dedup is turned on are kept; build with
+// BUILD_DEDUP to drop those. If on is false, the hash set is dropped.
+void setDedup(Graph G, bool on){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: setDedup(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(!on){
+        freeEdgeSet(&G->dedup);
+        return;
+    }
+    if(G->dedup==NULL){
+        G->dedup = newEdgeSet(G->vertices);
+        for(int x = 1; x<=G->vertices; x++){
+            int lo, hi;
+            baseRange(G, x, &lo, &hi);
+            for(int i = lo; i<hi; i++){
+                if(G->base->nbr[i]>0){
+                    edgeSetInsert(G->dedup, toExternal(G, x), toExternal(G, G->base->nbr[i]));
+                }
+            }
+            List L = G->adjacency[x];
+            for(moveFront(L); position(L)>=0; moveNext(L)){
+                if(get(L)>0){
+                    edgeSetInsert(G->dedup, toExternal(G, x), toExternal(G, get(L)));
+                }
+            }
+        }
+    }
+}
+
+// setHybrid()
+// If on is true, freezes the adjacency lists of G into a CSR base and keeps
+// later insertions in per-vertex delta lists. BFS() walks both, and the
+// deltas are merged into a new base once they pass 1/8 of the graph, so an
+// insertion costs O(1) amortized while searches run at near CSR speed.
+// addArc() appends to the delta list instead of keeping neighbors sorted.
+// If on is false, the base is moved back into the adjacency lists.
+void setHybrid(Graph G, bool on){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: setHybrid(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(on && G->base==NULL){
+        mergeBase(G);
+    }else if(!on && G->base!=NULL){
+        int* a = malloc((G->base->offset[G->vertices+1]+1)*sizeof(int));
+        int* b = malloc((G->base->offset[G->vertices+1]+1)*sizeof(int));
+        assert(a!=NULL && b!=NULL && "ERROR: setHybrid(): out of memory");
+        for(int x = 1; x<=G->vertices; x++){
+            int lo, hi;
+            int k = 0;
+            baseRange(G, x, &lo, &hi);
+            for(int i = lo; i<hi; i++){
+                if(G->base->nbr[i]>0){
+                    a[k] = G->base->nbr[i];
+                    b[k++] = (G->weight==NULL) ? 1 : G->base->weight[i];
+                }
+            }
+            List L = newListFromArray(a, k);
+            concatInto(L, G->adjacency[x]);
+            freeList(&G->adjacency[x]);
+            G->adjacency[x] = L;
+            if(G->weight!=NULL){
+                L = newListFromArray(b, k);
+                concatInto(L, G->weight[x]);
+                freeList(&G->weight[x]);
+                G->weight[x] = L;
+            }
+        }
+        free(a);
+        free(b);
+        freeCSR(&G->base);
+        G->churn = 0;
+    }
+}
+
+// makeWeighted()
+// Gives every arc of G weight 1 the first time a weighted arc is added.
+static void makeWeighted(Graph G){
+    if(G->weight!=NULL){
+        return;
+    }
+    G->weight = calloc(G->vertices+1, sizeof(List));
+    assert(G->weight!=NULL && "ERROR: makeWeighted(): out of memory");
+    for(int x = 1; x<=G->vertices; x++){
+        G->weight[x] = newList();
+        for(int i = 0; i<length(G->adjacency[x]); i++){
+            append(G->weight[x], 1);
+        }
+    }
+    if(G->base!=NULL){
+        int m = G->base->offset[G->vertices+1];
+        G->base->weight = malloc((m>0 ? m : 1)*sizeof(int));
+        assert(G->base->weight!=NULL && "ERROR: makeWeighted(): out of memory");
+        for(int i = 0; i<m; i++){
+            G->base->weight[i] = 1;
+        }
+    }
+}
+
+// afterInsert()
+// Brings the results of the most recent search up to date after the arc
+// x -> y of weight w was added, x and y internal. A BFS tree is repaired in
+// place; a weighted search is run again if the arc can shorten a path.
+static void afterInsert(Graph G, int x, int y, int w){
+    if(!G->incremental || G->source==NIL){
+        return;
+    }
+    if(G->partial){
+        BFSTo(G, toExternal(G, G->source), toExternal(G, G->target));
+    }else if(G->reversed){
+        // the arc is y -> x in the reversed graph
+        if(G->distance[y]!=INF && (G->distance[x]==INF || G->distance[x]>G->distance[y]+1)){
+            BFSReverse(G, toExternal(G, G->source));
+        }
+    }else if(!G->weighted){
+        repairBFS(G, x, y);
+    }else if(G->distance[x]!=INF && (G->distance[y]==INF || G->distance[y]>G->distance[x]+w)){
+        Dijkstra(G, toExternal(G, G->source));
+    }
+}
+
+// afterRemove()
+// Brings the results of the most recent search up to date after an arc
+// between x and y was removed, x and y internal. Only removing a tree arc
+// can make a distance longer, and then the search is run again.
+static void afterRemove(Graph G, int x, int y){
+    if(!G->incremental || G->source==NIL || (G->parent[y]!=x && G->parent[x]!=y)){
+        return;
+    }
+    if(G->target!=NIL){
+        BFSTo(G, toExternal(G, G->source), toExternal(G, G->target));
+    }else if(G->reversed){
+        BFSReverse(G, toExternal(G, G->source));
+    }else if(G->weighted){
+        Dijkstra(G, toExternal(G, G->source));
+    }else{
+        BFS(G, toExternal(G, G->source));
+    }
+}
+
+// insertEdge()
+// Adds the undirected edge u-v of weight w for addEdge() and
+// addWeightedEdge(). u and v are vertex numbers.
+static void insertEdge(Graph G, int u, int v, int w){
+    // with dedup on, only the directions not yet in G are added
+    bool uv = (G->dedup==NULL) || edgeSetInsert(G->dedup, u, v);
+    bool vu = (G->dedup==NULL) || edgeSetInsert(G->dedup, v, u);
+    if(!uv && !vu){
+        return;
+    }
+    u = toInternal(G, u);
+    v = toInternal(G, v);
+    if(uv){
+        append(G->adjacency[u], v);
+        if(G->weight!=NULL){
+            append(G->weight[u], w);
+        }
+    }
+    if(vu){
+        append(G->adjacency[v],u);
+        if(G->weight!=NULL){
+            append(G->weight[v], w);
+        }
+    }
+    G->edges++;
+    freeCSR(&G->transpose);
+    afterInsert(G, u, v, w);
+    afterInsert(G, v, u, w);
+    noteChange(G);
+}
+
+// insertArc()
+// Adds the arc u -> v of weight w for addArc() and addWeightedArc(). u and v
+// are vertex numbers.
+static void insertArc(Graph G, int u, int v, int w){
+    if(G->dedup!=NULL && !edgeSetInsert(G->dedup, u, v)){
+        return;
+    }
+    // keep the list sorted by vertex number, not by internal vertex, except
+    // for the delta lists of hybrid mode, which are only appended to
+    List L = G->adjacency[toInternal(G, u)];
+    List W = (G->weight==NULL) ? NULL : G->weight[toInternal(G, u)];
+    if(G->base!=NULL){
+        v = toInternal(G, v);
+        append(L,v);
+        if(W!=NULL){
+            append(W, w);
+        }
+    }else{
+        moveFront(L);
+        if(W!=NULL){
+            moveFront(W);
+        }
+        while(position(L)>=0 && toExternal(G, get(L))<v){
+            moveNext(L);
+            if(W!=NULL){
+                moveNext(W);
+            }
+        }
+        v = toInternal(G, v);
+        if(position(L)>=0){
+            insertBefore(L,v);
+            if(W!=NULL){
+                insertBefore(W, w);
+            }
+        } else{
+            append(L,v);
+            if(W!=NULL){
+                append(W, w);
+            }
+        }
+    }
+
+    G->edges++;
+    freeCSR(&G->transpose);
+    afterInsert(G, toInternal(G, u), v, w);
+    noteChange(G);
 }
 
 // addEdge()
-// Creates an undirected edge joining vertex u to vertex v.
+// Creates an undirected edge joining vertex u to vertex v. In a weighted
+// graph it has weight 1.
 // Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
 void addEdge(Graph G, int u, int v){
     if (G==NULL){
@@ -235,13 +853,12 @@ void addEdge(Graph G, int u, int v){
         fprintf(stderr, "GRAPH ERROR: addEdge(): v did not meet pre conditions");
         exit(EXIT_FAILURE);
     }
-    append(G->adjacency[u], v);
-    append(G->adjacency[v],u);
-    G->edges++;
+    insertEdge(G, u, v, 1);
 }
 
 // addArc()
-// Creates a directed edge joining vertex u to vertex v.
+// Creates a directed edge joining vertex u to vertex v. In a weighted graph
+// it has weight 1.
 // Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
 void addArc(Graph G, int u, int v){
     if (G==NULL){
@@ -256,18 +873,232 @@ void addArc(Graph G, int u, int v){
         fprintf(stderr, "GRAPH ERROR: addArc(): v did not meet pre conditions");
         exit(EXIT_FAILURE);
     }
-    List L = G->adjacency[u];
+    insertArc(G, u, v, 1);
+}
+
+// addWeightedEdge()
+// Creates an undirected edge of weight w joining vertex u to vertex v. The
+// first weighted edge or arc gives every earlier arc of G weight 1.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G), w >= 0
+void addWeightedEdge(Graph G, int u, int v, int w){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: addWeightedEdge(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1||u>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: addWeightedEdge(): u did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1||v>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: addWeightedEdge(): v did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    if(w<0){
+        fprintf(stderr, "GRAPH ERROR: addWeightedEdge(): negative weight");
+        exit(EXIT_FAILURE);
+    }
+    makeWeighted(G);
+    insertEdge(G, u, v, w);
+}
+
+// addWeightedArc()
+// Creates a directed edge of weight w joining vertex u to vertex v. The
+// first weighted edge or arc gives every earlier arc of G weight 1.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G), w >= 0
+void addWeightedArc(Graph G, int u, int v, int w){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: addWeightedArc(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1||u>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: addWeightedArc(): u did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1||v>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: addWeightedArc(): v did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    if(w<0){
+        fprintf(stderr, "GRAPH ERROR: addWeightedArc(): negative weight");
+        exit(EXIT_FAILURE);
+    }
+    makeWeighted(G);
+    insertArc(G, u, v, w);
+}
+
+// compact()
+// Rewrites the adjacency list of internal vertex x, and its weight list if
+// any, without its tombstones.
+static void compact(Graph G, int x){
+    List L = G->adjacency[x];
+    List W = (G->weight==NULL) ? NULL : G->weight[x];
+    int* a = malloc(length(L)*sizeof(int));
+    int* b = NULL;
+    assert(a!=NULL && "ERROR: compact(): out of memory");
+    int n = toArray(L, a);
+    if(W!=NULL){
+        b = malloc(length(W)*sizeof(int));
+        assert(b!=NULL && "ERROR: compact(): out of memory");
+        toArray(W, b);
+    }
+    int k = 0;
+    for(int i = 0; i<n; i++){
+        if(a[i]>0){
+            if(b!=NULL){
+                b[k] = b[i];
+            }
+            a[k++] = a[i];
+        }
+    }
+    clear(L);
+    appendArray(L, a, k);
+    if(W!=NULL){
+        clear(W);
+        appendArray(W, b, k);
+    }
+    G->dead[x] = 0;
+    free(a);
+    free(b);
+}
+
+// tombstone()
+// Marks the first live copy of internal vertex y among the neighbors of
+// internal vertex x as dead. A delta or plain list is compacted if too much
+// of it is dead; dead base entries wait for the next merge.
+// Returns false if y is not a neighbor of x.
+static bool tombstone(Graph G, int x, int y){
+    int lo, hi;
+    baseRange(G, x, &lo, &hi);
+    for(int i = lo; i<hi; i++){
+        if(G->base->nbr[i]==y){
+            G->base->nbr[i] = -y;
+            noteChange(G);
+            return true;
+        }
+    }
+    List L = G->adjacency[x];
     moveFront(L);
-    while(position(L)>=0 && get(L)<v){
+    while(position(L)>=0 && get(L)!=y){
         moveNext(L);
     }
-    if(position(L)>=0){
-        insertBefore(L,v);
-    } else{
-        append(L,v);
+    if(position(L)<0){
+        return false;
+    }
+    set(L, -y);
+    G->dead[x]++;
+    if(COMPACT_FRACTION*G->dead[x] > length(L)){
+        compact(G, x);
+    }
+    return true;
+}
+
+// hasNeighbor()
+// Returns true if a live copy of internal vertex y is among the neighbors of
+// internal vertex x. Used to keep the dedup set in step with lists that held
+// duplicates before setDedup() was turned on.
+static bool hasNeighbor(Graph G, int x, int y){
+    int lo, hi;
+    baseRange(G, x, &lo, &hi);
+    for(int i = lo; i<hi; i++){
+        if(G->base->nbr[i]==y){
+            return true;
+        }
+    }
+    List L = G->adjacency[x];
+    for(moveFront(L); position(L)>=0; moveNext(L)){
+        if(get(L)==y){
+            return true;
+        }
+    }
+    return false;
+}
+
+// removeEdge()
+// Deletes one undirected edge joining vertex u to vertex v. Returns false if
+// there is no such edge. With setIncremental() on, a BFS tree that used the
+// edge is rebuilt.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
+bool removeEdge(Graph G, int u, int v){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: removeEdge(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1||u>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: removeEdge(): u did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1||v>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: removeEdge(): v did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    int x = toInternal(G, u);
+    int y = toInternal(G, v);
+    bool xy = tombstone(G, x, y);
+    bool yx = tombstone(G, y, x);
+    if(!xy && !yx){
+        return false;
+    }
+    if(G->dedup!=NULL && !hasNeighbor(G, x, y)){
+        edgeSetRemove(G->dedup, u, v);
+    }
+    if(G->dedup!=NULL && !hasNeighbor(G, y, x)){
+        edgeSetRemove(G->dedup, v, u);
+    }
+    G->edges--;
+    freeCSR(&G->transpose);
+    afterRemove(G, x, y);
+    return true;
+}
+
+// removeArc()
+// Deletes one directed edge joining vertex u to vertex v. Returns false if
+// there is no such edge. With setIncremental() on, a BFS tree that used the
+// arc is rebuilt.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
+bool removeArc(Graph G, int u, int v){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: removeArc(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1||u>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: removeArc(): u did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1||v>G->vertices){
+        fprintf(stderr, "GRAPH ERROR: removeArc(): v did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    int x = toInternal(G, u);
+    int y = toInternal(G, v);
+    if(!tombstone(G, x, y)){
+        return false;
+    }
+    if(G->dedup!=NULL && !hasNeighbor(G, x, y)){
+        edgeSetRemove(G->dedup, u, v);
+    }
+    G->edges--;
+    freeCSR(&G->transpose);
+    afterRemove(G, x, y);
+    return true;
+}
+
+// compactGraph()
+// Rewrites every adjacency list of G that holds tombstones, so that a caller
+// can pay for compaction at a quiet time instead of during removals.
+void compactGraph(Graph G){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: compactGraph(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(G->base!=NULL){
+        mergeBase(G);
+        return;
+    }
+    for(int x = 1; x<=G->vertices; x++){
+        if(G->dead[x]>0){
+            compact(G, x);
+        }
     }
-    
-    G->edges++;
 }
 
 // BFS()
@@ -287,7 +1118,13 @@ void BFS(Graph G, int s){
         G->parent[x]=NIL;
     }
 
+    s = toInternal(G, s);
     G->source = s;
+    G->weighted = false;
+    G->reversed = false;
+    G->target = NIL;
+    G->partial = false;
+    G->touched = -1;
     G->color[s] = grey;
     G->distance[s] = 0;
     G->parent[s]= NIL;
@@ -298,9 +1135,20 @@ void BFS(Graph G, int s){
         int x = front(L);
         deleteFront(L);
 
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        for(int i = lo; i<hi; i++){
+            int y = G->base->nbr[i];
+            if (y>0 && G->color[y] == white){
+                G->color[y] = grey;
+                G->distance[y] = G->distance[x]+1;
+                G->parent[y] = x;
+                append(L,y);
+            }
+        }
         for(moveFront(G->adjacency[x]); position(G->adjacency[x])>=0; moveNext(G->adjacency[x])){
             int y = get(G->adjacency[x]);
-            if (G->color[y] == white){
+            if (y>0 && G->color[y] == white){
                 G->color[y] = grey;
                 G->distance[y] = G->distance[x]+1;
                 G->parent[y] = x;
@@ -312,6 +1160,936 @@ void BFS(Graph G, int s){
     freeList(&L);
 }
 
+// BFSTo()
+// Runs BFS() on G from source vertex s but stops as soon as t is reached.
+// Parents and distances are valid for every vertex reached, so getPath(L,
+// G, t) gives a shortest s-t path. If the search stopped early, getDist()
+// returns UNKNOWN for the vertices it did not reach. Only the vertices the
+// previous BFSTo() reached are reset, so a nearby t costs only what the
+// search touches.
+// Pre: 1 <= s <= getOrder(G), 1 <= t <= getOrder(G)
+void BFSTo(Graph G, int s, int t){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: BFSTo(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0||t>G->vertices||t<=0){
+        fprintf(stderr,"GRAPH ERROR: BFSTo(): invalid source or target vertex");
+        exit(EXIT_FAILURE);
+    }
+    if(G->queue==NULL){
+        G->queue = malloc((G->vertices+1)*sizeof(int));
+        assert(G->queue!=NULL && "ERROR: BFSTo(): out of memory");
+    }
+    int n = (G->touched<0) ? G->vertices : G->touched;
+    for(int i = 0; i<n; i++){
+        int x = (G->touched<0) ? i+1 : G->queue[i];
+        G->color[x] = white;
+        G->distance[x] = INF;
+        G->parent[x] = NIL;
+    }
+
+    s = toInternal(G, s);
+    t = toInternal(G, t);
+    G->source = s;
+    G->target = t;
+    G->weighted = false;
+    G->reversed = false;
+    G->color[s] = grey;
+    G->distance[s] = 0;
+
+    int head = 0, tail = 0;
+    G->queue[tail++] = s;
+    bool found = (s==t);
+    while(head<tail && !found){
+        int x = G->queue[head++];
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        for(int i = lo; i<hi && !found; i++){
+            int y = G->base->nbr[i];
+            if(y>0 && G->color[y]==white){
+                G->color[y] = grey;
+                G->distance[y] = G->distance[x]+1;
+                G->parent[y] = x;
+                G->queue[tail++] = y;
+                found = (y==t);
+            }
+        }
+        List L = G->adjacency[x];
+        for(moveFront(L); position(L)>=0 && !found; moveNext(L)){
+            int y = get(L);
+            if(y>0 && G->color[y]==white){
+                G->color[y] = grey;
+                G->distance[y] = G->distance[x]+1;
+                G->parent[y] = x;
+                G->queue[tail++] = y;
+                found = (y==t);
+            }
+        }
+        if(!found){
+            G->color[x] = black;
+        }
+    }
+    G->touched = tail;
+    G->partial = found && tail<G->vertices;
+}
+
+// BFSBegin()
+// Returns a context for a BFS of G from source vertex s that BFSStep() runs
+// a slice at a time. Results are kept in the context, not in G, so several
+// searches can be interleaved. Arrays are zeroed lazily by calloc(), so
+// starting costs no pass over the vertices.
+// Pre: 1 <= s <= getOrder(G), G is not changed until BFSDone()
+BFSContext BFSBegin(Graph G, int s){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: BFSBegin(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0){
+        fprintf(stderr,"GRAPH ERROR: BFSBegin(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    BFSContext C = malloc(sizeof(BFSContextObj));
+    assert(C!=NULL && "ERROR: BFSBegin(): out of memory");
+    C->G = G;
+    C->dist = calloc(G->vertices+1, sizeof(int));
+    C->parent = calloc(G->vertices+1, sizeof(int));
+    C->queue = malloc((G->vertices+1)*sizeof(int));
+    assert(C->dist!=NULL && C->parent!=NULL && C->queue!=NULL
+           && "ERROR: BFSBegin(): out of memory");
+    s = toInternal(G, s);
+    C->dist[s] = 1;
+    C->queue[0] = s;
+    C->head = 0;
+    C->tail = 1;
+    C->next = 0;
+    C->nbr = NULL;
+    C->capacity = 0;
+    C->loaded = false;
+    C->done = false;
+    return C;
+}
+
+// discover()
+// Helper for BFSStep(). Queues y as a child of x if it is unreached.
+static void discover(BFSContext C, int x, int y){
+    if(y>0 && C->dist[y]==0){
+        C->dist[y] = C->dist[x]+1;
+        C->parent[y] = x;
+        C->queue[C->tail++] = y;
+    }
+}
+
+// BFSStep()
+// Continues the search of C, scanning at most maxEdges arcs, or every
+// remaining arc if maxEdges <= 0. Returns true once the search is done. A
+// neighbor list is copied into C before it is scanned, so a slice that stops
+// in the middle of it resumes in constant time and the cursors of G are never
+// moved. Contexts over the same G can be stepped from different threads.
+bool BFSStep(BFSContext C, long maxEdges){
+    if (C==NULL){
+        fprintf(stderr,"GRAPH ERROR: BFSStep(): NULL BFSContext");
+        exit(EXIT_FAILURE);
+    }
+    Graph G = C->G;
+    long budget = (maxEdges<=0) ? LONG_MAX : maxEdges;
+    while(C->head<C->tail){
+        int x = C->queue[C->head];
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        int frozen = hi-lo;
+        List L = G->adjacency[x];
+        int degree = frozen+length(L);
+        for(; C->next<frozen && budget>0; C->next++, budget--){
+            discover(C, x, G->base->nbr[lo+C->next]);
+        }
+        if(C->next<degree && budget>0){
+            if(!C->loaded){
+                if(length(L)>C->capacity){
+                    C->capacity = length(L);
+                    free(C->nbr);
+                    C->nbr = malloc(C->capacity*sizeof(int));
+                    assert(C->nbr!=NULL && "ERROR: BFSStep(): out of memory");
+                }
+                toArray(L, C->nbr);
+                C->loaded = true;
+            }
+            for(; C->next<degree && budget>0; C->next++, budget--){
+                discover(C, x, C->nbr[C->next-frozen]);
+            }
+        }
+        if(C->next<degree){
+            return false;
+        }
+        C->head++;
+        C->next = 0;
+        C->loaded = false;
+    }
+    C->done = true;
+    return true;
+}
+
+// getSearchDist()
+// Returns the distance from the source of C to u if the search has reached
+// u, INF if it is done without reaching u, and UNKNOWN otherwise.
+// Pre: 1 <= u <= getOrder(G)
+int getSearchDist(BFSContext C, int u){
+    if (C==NULL){
+        fprintf(stderr,"GRAPH ERROR: getSearchDist(): NULL BFSContext");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1 || u>C->G->vertices){
+        fprintf(stderr,"GRAPH ERROR: getSearchDist(): u did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    int x = toInternal(C->G, u);
+    if(C->dist[x]>0){
+        return C->dist[x]-1;
+    }
+    return C->done ? INF : UNKNOWN;
+}
+
+// getSearchParent()
+// Returns the parent of u in the BFS tree of C, or NIL if u is the source
+// or has not been reached. Pre: 1 <= u <= getOrder(G)
+int getSearchParent(BFSContext C, int u){
+    if (C==NULL){
+        fprintf(stderr,"GRAPH ERROR: getSearchParent(): NULL BFSContext");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1 || u>C->G->vertices){
+        fprintf(stderr,"GRAPH ERROR: getSearchParent(): u did not meet pre conditions");
+        exit(EXIT_FAILURE);
+    }
+    int p = C->parent[toInternal(C->G, u)];
+    return (p==0) ? NIL : toExternal(C->G, p);
+}
+
+// BFSDone()
+// Frees heap memory associated with *pC, sets *pC to NULL. The search may
+// be finished or not.
+void BFSDone(BFSContext* pC){
+    if(pC!=NULL && *pC!=NULL){
+        free((*pC)->dist);
+        free((*pC)->parent);
+        free((*pC)->queue);
+        free((*pC)->nbr);
+        free(*pC);
+        *pC = NULL;
+    }
+}
+
+// BFSReverse()
+// Runs BFS() on G with every arc reversed, from source vertex s, through the
+// in-neighbor index. Afterwards getDist(G, u) is the distance from u to s,
+// getParent(G, u) is the next vertex on a shortest u-s path, and getPath()
+// lists such a path from s back to u. Arc weights are ignored.
+void BFSReverse(Graph G, int s){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: BFSReverse(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0){
+        fprintf(stderr,"GRAPH ERROR: BFSReverse(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    needTranspose(G, 1);
+    for(int x=1; x<=G->vertices; x++){
+        G->color[x]=white;
+        G->distance[x] = INF;
+        G->parent[x]=NIL;
+    }
+    if(G->queue==NULL){
+        G->queue = malloc((G->vertices+1)*sizeof(int));
+        assert(G->queue!=NULL && "ERROR: BFSReverse(): out of memory");
+    }
+
+    s = toInternal(G, s);
+    G->source = s;
+    G->weighted = false;
+    G->reversed = true;
+    G->target = NIL;
+    G->partial = false;
+    G->touched = -1;
+    G->color[s] = grey;
+    G->distance[s] = 0;
+
+    CSR T = G->transpose;
+    int head = 0, tail = 0;
+    G->queue[tail++] = s;
+    while(head<tail){
+        int x = G->queue[head++];
+        for(int i = T->offset[x]; i<T->offset[x+1]; i++){
+            int y = T->nbr[i];
+            if(G->color[y]==white){
+                G->color[y] = grey;
+                G->distance[y] = G->distance[x]+1;
+                G->parent[y] = x;
+                G->queue[tail++] = y;
+            }
+        }
+        G->color[x] = black;
+    }
+}
+
+// newEpoch()
+// Starts a bounded search: every vertex counts as unseen until its stamp is
+// set to the returned epoch, so nothing is cleared per search. The stamps
+// are only reset when the epoch counter wraps around.
+static int newEpoch(Graph G){
+    if(G->stamp==NULL){
+        G->stamp = calloc(G->vertices+1, sizeof(int));
+        assert(G->stamp!=NULL && "ERROR: newEpoch(): out of memory");
+    }
+    if(G->epoch==INT_MAX){
+        memset(G->stamp, 0, (G->vertices+1)*sizeof(int));
+        G->epoch = 0;
+    }
+    return ++G->epoch;
+}
+
+// hop()
+// Helper for kHopNeighbors(). Records the internal vertex y at distance d
+// as found, unless it is a tombstone or was seen already. Returns false once
+// out is full.
+static bool hop(Graph G, int y, int d, int* out, int* dist, int* count, int cap){
+    if(y>0 && G->stamp[y]!=G->epoch){
+        G->stamp[y] = G->epoch;
+        out[*count] = y;
+        if(dist!=NULL){
+            dist[*count] = d;
+        }
+        (*count)++;
+    }
+    return *count<cap;
+}
+
+// kHopNeighbors()
+// Writes the vertices at distance 1..k from u into out, in order of
+// distance, and their distances into dist unless it is NULL. Returns how
+// many were written. The search stops early once cap vertices are found or
+// once budget arcs have been scanned, if budget > 0, and then the result is
+// the start of the full answer. Visit marks are epoch stamps, so a query
+// costs only what it touches and leaves the BFS() results of G alone.
+// Pre: 1 <= u <= getOrder(G), k >= 0, out and dist have room for cap ints
+int kHopNeighbors(Graph G, int u, int k, int* out, int* dist, int cap, long budget){
+    if (G==NULL || out==NULL){
+        fprintf(stderr,"GRAPH ERROR: kHopNeighbors(): NULL reference");
+        exit(EXIT_FAILURE);
+    }
+    if(u>G->vertices||u<=0){
+        fprintf(stderr,"GRAPH ERROR: kHopNeighbors(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    int x = toInternal(G, u);
+    newEpoch(G);
+    G->stamp[x] = G->epoch;
+    if(k<1 || cap<1){
+        return 0;
+    }
+
+    // out[head..end) are the vertices at depth d still to be expanded
+    int count = 0, head = 0, end = 0, d = 0;
+    long scanned = 0;
+    bool room = true;
+    while(room){
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        for(int i = lo; i<hi && room; i++){
+            room = hop(G, G->base->nbr[i], d+1, out, dist, &count, cap);
+            room = room && (budget<=0 || ++scanned<budget);
+        }
+        List L = G->adjacency[x];
+        for(moveFront(L); position(L)>=0 && room; moveNext(L)){
+            room = hop(G, get(L), d+1, out, dist, &count, cap);
+            room = room && (budget<=0 || ++scanned<budget);
+        }
+        if(head==end){
+            d++;
+            end = count;
+        }
+        if(head==count || d>=k){
+            break;
+        }
+        x = out[head++];
+    }
+    for(int i = 0; i<count; i++){
+        out[i] = toExternal(G, out[i]);
+    }
+    return count;
+}
+
+typedef struct matrixArgs{
+    CSR C;                  // arcs of G by internal vertex
+    const int* S;           // sources by internal vertex
+    int ns;
+    const int* T;           // targets by internal vertex
+    int nt;
+    const bool* target;     // target[x] is true if x is in T
+    int targets;            // distinct targets
+    int* M;
+    atomic_int next;        // index of the next source to hand out
+} matrixArgs;
+
+// matrixTask()
+// Every thread takes sources one at a time and fills in their rows of the
+// matrix, each with a BFS of the CSR that stops once every target has been
+// reached. Only the vertices a search reached are reset for the next one.
+static void matrixTask(int id, int threads, void* p){
+    matrixArgs* A = p;
+    CSR C = A->C;
+    int* dist = malloc((C->n+1)*sizeof(int));
+    int* queue = malloc((C->n+1)*sizeof(int));
+    assert(dist!=NULL && queue!=NULL && "ERROR: distanceMatrix(): out of memory");
+    for(int x = 0; x<=C->n; x++){
+        dist[x] = INF;
+    }
+    for(;;){
+        int r = atomic_fetch_add_explicit(&A->next, 1, memory_order_relaxed);
+        if(r>=A->ns){
+            break;
+        }
+        int s = A->S[r];
+        int head = 0, tail = 0;
+        int reached = A->target[s] ? 1 : 0;
+        dist[s] = 0;
+        queue[tail++] = s;
+        while(head<tail && reached<A->targets){
+            int x = queue[head++];
+            for(int i = C->offset[x]; i<C->offset[x+1]; i++){
+                int y = C->nbr[i];
+                if(dist[y]==INF){
+                    dist[y] = dist[x]+1;
+                    queue[tail++] = y;
+                    if(A->target[y]){
+                        reached++;
+                    }
+                }
+            }
+        }
+        int* row = A->M+(long)r*A->nt;
+        for(int j = 0; j<A->nt; j++){
+            row[j] = dist[A->T[j]];
+        }
+        for(int i = 0; i<tail; i++){
+            dist[queue[i]] = INF;
+        }
+    }
+    free(dist);
+    free(queue);
+}
+
+// distanceMatrix()
+// Sets M[i*nt+j] to the distance from S[i] to T[j], or to INF (-1) if T[j]
+// cannot be reached, for 0 <= i < ns and 0 <= j < nt. Runs one BFS per
+// source on a CSR copy of G, stopping once every target is reached, with
+// the sources shared by threads worker threads. The BFS() results of G are
+// left alone.
+// Pre: 1 <= S[i], T[j] <= getOrder(G), M has room for ns*nt ints
+void distanceMatrix(Graph G, const int* S, int ns, const int* T, int nt, int* M, int threads){
+    if (G==NULL || (ns>0 && S==NULL) || (nt>0 && T==NULL) || (ns>0 && nt>0 && M==NULL)){
+        fprintf(stderr,"GRAPH ERROR: distanceMatrix(): NULL reference");
+        exit(EXIT_FAILURE);
+    }
+    int n = G->vertices;
+    int* source = malloc((ns>0 ? ns : 1)*sizeof(int));
+    int* sink = malloc((nt>0 ? nt : 1)*sizeof(int));
+    bool* target = calloc(n+1, sizeof(bool));
+    assert(source!=NULL && sink!=NULL && target!=NULL && "ERROR: distanceMatrix(): out of memory");
+    matrixArgs A;
+    A.targets = 0;
+    for(int j = 0; j<nt; j++){
+        if(T[j]<1 || T[j]>n){
+            fprintf(stderr,"GRAPH ERROR: distanceMatrix(): invalid target vertex");
+            exit(EXIT_FAILURE);
+        }
+        sink[j] = toInternal(G, T[j]);
+        if(!target[sink[j]]){
+            target[sink[j]] = true;
+            A.targets++;
+        }
+    }
+    for(int i = 0; i<ns; i++){
+        if(S[i]<1 || S[i]>n){
+            fprintf(stderr,"GRAPH ERROR: distanceMatrix(): invalid source vertex");
+            exit(EXIT_FAILURE);
+        }
+        source[i] = toInternal(G, S[i]);
+    }
+    A.C = exportCSR(G, false);
+    A.S = source;
+    A.ns = ns;
+    A.T = sink;
+    A.nt = nt;
+    A.target = target;
+    A.M = M;
+    atomic_init(&A.next, 0);
+    parallelRun(threads, matrixTask, &A);
+
+    freeCSR(&A.C);
+    free(source);
+    free(sink);
+    free(target);
+}
+
+
+// The vertices waiting in a weighted search. Exactly one of H, R, deque and
+// bucket is in use.
+typedef struct frontier{
+    Heap H;             // Dijkstra()
+    RadixHeap R;        // DijkstraRadix()
+    List deque;         // BFS01(): weight 0 arcs in front, weight 1 in back
+    List* bucket;       // Dial(): bucket[d % buckets] holds distance d
+    int buckets;
+    int pending;        // entries in the buckets
+    int current;        // distance of the bucket being emptied
+} frontier;
+
+// lower()
+// Helper for weightedSearch(). Lowers the distance of y through the arc
+// x -> y of weight w, and puts y on the frontier F.
+static void lower(Graph G, int x, int y, int w, frontier* F){
+    int* d = G->distance;
+    if(y<0 || G->color[y]==black || (d[y]!=INF && d[y]<=d[x]+w)){
+        return;
+    }
+    d[y] = d[x]+w;
+    G->parent[y] = x;
+    if(F->H!=NULL){
+        heapPush(F->H, y, d[y]);
+    }else if(F->R!=NULL){
+        radixPush(F->R, y, d[y]);
+    }else if(F->deque!=NULL){
+        if(w>1){
+            fprintf(stderr,"GRAPH ERROR: BFS01(): arc weight above 1");
+            exit(EXIT_FAILURE);
+        }
+        if(w==0){
+            prepend(F->deque, y);
+        }else{
+            append(F->deque, y);
+        }
+    }else{
+        append(F->bucket[d[y] % F->buckets], y);
+        F->pending++;
+    }
+}
+
+// nextVertex()
+// Helper for weightedSearch(). Takes the next vertex off the frontier F and
+// returns it, or returns NIL if F is empty. The deque and the buckets may
+// hand out a vertex again after it is done; the search skips those.
+static int nextVertex(frontier* F){
+    int k, x;
+    if(F->H!=NULL){
+        return (heapSize(F->H)>0) ? heapPop(F->H, &k) : NIL;
+    }
+    if(F->R!=NULL){
+        return radixEmpty(F->R) ? NIL : radixPop(F->R, &k);
+    }
+    if(F->deque!=NULL){
+        if(length(F->deque)==0){
+            return NIL;
+        }
+        x = front(F->deque);
+        deleteFront(F->deque);
+        return x;
+    }
+    if(F->pending==0){
+        return NIL;
+    }
+    List B = F->bucket[F->current % F->buckets];
+    while(length(B)==0){
+        F->current++;
+        B = F->bucket[F->current % F->buckets];
+    }
+    x = back(B);
+    deleteBack(B);
+    F->pending--;
+    return x;
+}
+
+// weightedSearch()
+// Runs a label setting shortest path search on G from internal vertex s,
+// keeping the waiting vertices on the frontier F. Vertices leave F in order
+// of distance, so each is finished the first time it comes off. Arcs of an
+// unweighted G weigh 1.
+static void weightedSearch(Graph G, int s, frontier* F){
+    for(int x=1; x<=G->vertices; x++){
+        G->color[x]=white;
+        G->distance[x] = INF;
+        G->parent[x]=NIL;
+    }
+    G->source = s;
+    G->weighted = true;
+    G->reversed = false;
+    G->target = NIL;
+    G->partial = false;
+    G->touched = -1;
+    G->distance[s] = 0;
+    G->color[s] = grey;
+    if(F->H!=NULL){
+        heapPush(F->H, s, 0);
+    }else if(F->R!=NULL){
+        radixPush(F->R, s, 0);
+    }else if(F->deque!=NULL){
+        append(F->deque, s);
+    }else{
+        append(F->bucket[0], s);
+        F->pending++;
+    }
+    for(int x = nextVertex(F); x!=NIL; x = nextVertex(F)){
+        if(G->color[x]==black){
+            continue;
+        }
+        G->color[x] = black;
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        for(int i = lo; i<hi; i++){
+            int w = (G->weight==NULL) ? 1 : G->base->weight[i];
+            lower(G, x, G->base->nbr[i], w, F);
+        }
+        List L = G->adjacency[x];
+        List W = (G->weight==NULL) ? NULL : G->weight[x];
+        if(W!=NULL){
+            moveFront(W);
+        }
+        for(moveFront(L); position(L)>=0; moveNext(L)){
+            int w = 1;
+            if(W!=NULL){
+                w = get(W);
+                moveNext(W);
+            }
+            lower(G, x, get(L), w, F);
+        }
+    }
+}
+
+// Dijkstra()
+// Runs Dijkstra's algorithm on G from source vertex s with an indexed 4-ary
+// heap. Afterwards getDist() is the weight of a lightest path, and getParent()
+// and getPath() follow lightest paths. An unweighted G has weight 1 arcs.
+// Pre: 1 <= s <= getOrder(G)
+void Dijkstra(Graph G, int s){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: Dijkstra(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0){
+        fprintf(stderr,"GRAPH ERROR: Dijkstra(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    frontier F = {0};
+    F.H = newHeap(G->vertices);
+    weightedSearch(G, toInternal(G, s), &F);
+    freeHeap(&F.H);
+}
+
+// DijkstraRadix()
+// Same as Dijkstra(), but with a monotone radix heap, which does less work
+// per operation when the weights are small integers.
+// Pre: 1 <= s <= getOrder(G)
+void DijkstraRadix(Graph G, int s){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: DijkstraRadix(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0){
+        fprintf(stderr,"GRAPH ERROR: DijkstraRadix(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    frontier F = {0};
+    F.R = newRadixHeap(G->vertices);
+    weightedSearch(G, toInternal(G, s), &F);
+    freeRadixHeap(&F.R);
+}
+
+// BFS01()
+// Same as Dijkstra() for a G whose arcs all weigh 0 or 1, in O(n+m) time. A
+// deque replaces the heap: weight 0 arcs put their end in front and weight 1
+// arcs put it in back. Pre: 1 <= s <= getOrder(G), no arc weighs more than 1
+void BFS01(Graph G, int s){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: BFS01(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0){
+        fprintf(stderr,"GRAPH ERROR: BFS01(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    frontier F = {0};
+    F.deque = newList();
+    weightedSearch(G, toInternal(G, s), &F);
+    freeList(&F.deque);
+}
+
+// maxWeight()
+// Returns the largest weight of a live arc of G, or 1 if G is unweighted.
+static int maxWeight(Graph G){
+    if(G->weight==NULL){
+        return 1;
+    }
+    int c = 0;
+    for(int x = 1; x<=G->vertices; x++){
+        int lo, hi;
+        baseRange(G, x, &lo, &hi);
+        for(int i = lo; i<hi; i++){
+            if(G->base->nbr[i]>0 && G->base->weight[i]>c){
+                c = G->base->weight[i];
+            }
+        }
+        List L = G->adjacency[x];
+        List W = G->weight[x];
+        for(moveFront(L), moveFront(W); position(L)>=0; moveNext(L), moveNext(W)){
+            if(get(L)>0 && get(W)>c){
+                c = get(W);
+            }
+        }
+    }
+    return c;
+}
+
+// Dial()
+// Same as Dijkstra() with Dial's bucket queue: a ring of C+1 buckets, C the
+// largest arc weight, where bucket d % (C+1) holds the vertices at distance
+// d. Runs in O(n+m+D) time, D the largest distance, so it suits small
+// integer weights. Pre: 1 <= s <= getOrder(G)
+void Dial(Graph G, int s){
+    if (G==NULL){
+        fprintf(stderr,"GRAPH ERROR: Dial(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if(s>G->vertices||s<=0){
+        fprintf(stderr,"GRAPH ERROR: Dial(): invalid source vertex");
+        exit(EXIT_FAILURE);
+    }
+    frontier F = {0};
+    F.buckets = maxWeight(G)+1;
+    F.bucket = calloc(F.buckets, sizeof(List));
+    assert(F.bucket!=NULL && "ERROR: Dial(): out of memory");
+    for(int i = 0; i<F.buckets; i++){
+        F.bucket[i] = newList();
+    }
+    weightedSearch(G, toInternal(G, s), &F);
+    for(int i = 0; i<F.buckets; i++){
+        freeList(&F.bucket[i]);
+    }
+    free(F.bucket);
+}
+
+// compareLong()
+// qsort() comparison for longs.
+static int compareLong(const void* a, const void* b){
+    long x = *(const long*)a;
+    long y = *(const long*)b;
+    return (x > y) - (x < y);
+}
+
+// orderRCM()
+// Writes a Reverse Cuthill-McKee ordering of the vertices of C into order.
+// Every component is searched from an unvisited vertex of minimum degree and
+// the unvisited neighbors of each vertex are queued by increasing degree.
+static void orderRCM(CSR C, int* order){
+    int n = C->n;
+    bool* seen = calloc(n+1, sizeof(bool));
+    long* key = malloc((n+1)*sizeof(long));
+    assert(seen!=NULL && key!=NULL && "ERROR: reorderGraph(): out of memory");
+
+    // start candidates by increasing degree, ties by vertex
+    for(int x = 1; x<=n; x++){
+        key[x-1] = (long)(C->offset[x+1]-C->offset[x])*(n+1) + x;
+    }
+    qsort(key, n, sizeof(long), compareLong);
+    int* start = malloc((n+1)*sizeof(int));
+    assert(start!=NULL && "ERROR: reorderGraph(): out of memory");
+    for(int i = 0; i<n; i++){
+        start[i] = (int)(key[i] % (n+1));
+    }
+
+    int head = 0, tail = 0;
+    for(int i = 0; i<n; i++){
+        if(seen[start[i]]){
+            continue;
+        }
+        seen[start[i]] = true;
+        order[tail++] = start[i];
+        while(head<tail){
+            int x = order[head++];
+            int k = 0;
+            for(int j = C->offset[x]; j<C->offset[x+1]; j++){
+                int y = C->nbr[j];
+                if(!seen[y]){
+                    seen[y] = true;
+                    key[k++] = (long)(C->offset[y+1]-C->offset[y])*(n+1) + y;
+                }
+            }
+            qsort(key, k, sizeof(long), compareLong);
+            for(int j = 0; j<k; j++){
+                order[tail++] = (int)(key[j] % (n+1));
+            }
+        }
+    }
+    for(int i = 0, j = n-1; i<j; i++, j--){
+        int t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+    free(seen);
+    free(key);
+    free(start);
+}
+
+// orderBFS()
+// Writes the order in which breadth first searches started from vertex 1,
+// then from every vertex not yet reached, discover the vertices of C.
+static void orderBFS(CSR C, int* order){
+    int n = C->n;
+    bool* seen = calloc(n+1, sizeof(bool));
+    assert(seen!=NULL && "ERROR: reorderGraph(): out of memory");
+    int head = 0, tail = 0;
+    for(int s = 1; s<=n; s++){
+        if(seen[s]){
+            continue;
+        }
+        seen[s] = true;
+        order[tail++] = s;
+        while(head<tail){
+            int x = order[head++];
+            for(int j = C->offset[x]; j<C->offset[x+1]; j++){
+                int y = C->nbr[j];
+                if(!seen[y]){
+                    seen[y] = true;
+                    order[tail++] = y;
+                }
+            }
+        }
+    }
+    free(seen);
+}
+
+// orderDegree()
+// Writes the vertices of C by decreasing degree, ties by vertex, using a
+// counting sort.
+static void orderDegree(CSR C, int* order){
+    int n = C->n;
+    int maxDeg = 0;
+    for(int x = 1; x<=n; x++){
+        int d = C->offset[x+1]-C->offset[x];
+        if(d>maxDeg){
+            maxDeg = d;
+        }
+    }
+    int* count = calloc(maxDeg+2, sizeof(int));
+    assert(count!=NULL && "ERROR: reorderGraph(): out of memory");
+    for(int x = 1; x<=n; x++){
+        count[maxDeg - (C->offset[x+1]-C->offset[x])]++;
+    }
+    for(int d = 0, run = 0; d<=maxDeg; d++){
+        int c = count[d];
+        count[d] = run;
+        run += c;
+    }
+    for(int x = 1; x<=n; x++){
+        order[count[maxDeg - (C->offset[x+1]-C->offset[x])]++] = x;
+    }
+    free(count);
+}
+
+// reorderGraph()
+// Relabels the internal vertices of G so that vertices that are searched
+// together sit together in memory. method is one of ORDER_RCM (Reverse
+// Cuthill-McKee), ORDER_BFS (breadth first discovery order) or ORDER_DEGREE
+// (decreasing degree). Vertex numbers passed to and returned by every other
+// function are unchanged, as are the order of each adjacency list and the
+// results of the most recent BFS(). Every adjacency list is compacted.
+void reorderGraph(Graph G, int method){
+    if (G==NULL){
+        fprintf(stderr, "GRAPH ERROR: reorderGraph(): NULL Graph");
+        exit(EXIT_FAILURE);
+    }
+    if (method!=ORDER_RCM && method!=ORDER_BFS && method!=ORDER_DEGREE){
+        fprintf(stderr, "GRAPH ERROR: reorderGraph(): unknown method");
+        exit(EXIT_FAILURE);
+    }
+    int n = G->vertices;
+    CSR C = exportCSR(G, false);
+    bool hybrid = (G->base!=NULL);
+    freeCSR(&G->base);
+    freeCSR(&G->transpose);
+    int* order = malloc((n+1)*sizeof(int));
+    int* pos = malloc((n+1)*sizeof(int));
+    assert(order!=NULL && pos!=NULL && "ERROR: reorderGraph(): out of memory");
+    if(method==ORDER_RCM){
+        orderRCM(C, order);
+    }else if(method==ORDER_BFS){
+        orderBFS(C, order);
+    }else{
+        orderDegree(C, order);
+    }
+    // pos[x] is the new internal vertex of the current internal vertex x
+    for(int i = 0; i<n; i++){
+        pos[order[i]] = i+1;
+    }
+
+    List* adjacency = calloc(n+1, sizeof(List));
+    int* color = calloc(n+1, sizeof(int));
+    int* parent = calloc(n+1, sizeof(int));
+    int* distance = calloc(n+1, sizeof(int));
+    int* label = calloc(n+1, sizeof(int));
+    int* index = calloc(n+1, sizeof(int));
+    List* weight = (G->weight==NULL) ? NULL : calloc(n+1, sizeof(List));
+    assert(adjacency!=NULL && color!=NULL && parent!=NULL && distance!=NULL
+           && label!=NULL && index!=NULL && (G->weight==NULL || weight!=NULL)
+           && "ERROR: reorderGraph(): out of memory");
+    for(int x = 1; x<=n; x++){
+        int y = pos[x];
+        adjacency[y] = newList();
+        for(int j = C->offset[x]; j<C->offset[x+1]; j++){
+            append(adjacency[y], pos[C->nbr[j]]);
+        }
+        freeList(&G->adjacency[x]);
+        if(weight!=NULL){
+            weight[y] = newListFromArray(C->weight+C->offset[x], C->offset[x+1]-C->offset[x]);
+            freeList(&G->weight[x]);
+        }
+        G->dead[x] = 0;
+        color[y] = G->color[x];
+        parent[y] = (G->parent[x]<1) ? G->parent[x] : pos[G->parent[x]];
+        distance[y] = G->distance[x];
+        label[y] = toExternal(G, x);
+        index[label[y]] = y;
+    }
+    if(G->source>=1){
+        G->source = pos[G->source];
+    }
+    if(G->target>=1){
+        G->target = pos[G->target];
+    }
+    G->touched = -1;
+
+    free(G->adjacency);
+    free(G->color);
+    free(G->parent);
+    free(G->distance);
+    free(G->label);
+    free(G->index);
+    free(G->weight);
+    G->adjacency = adjacency;
+    G->weight = weight;
+    G->color = color;
+    G->parent = parent;
+    G->distance = distance;
+    G->label = label;
+    G->index = index;
+
+    freeCSR(&C);
+    free(order);
+    free(pos);
+    if(hybrid){
+        mergeBase(G);
+    }
+}
+
 
 // other functions ------------------------------------------------------------
 
@@ -329,13 +2107,46 @@ void printGraph(FILE* out, Graph G){
 
     for (int i=1; i<=G->vertices; i++){
         fprintf(out, "%d: (", i);
-        for(moveFront(G->adjacency[i]); position(G->adjacency[i])>=0; moveNext(G->adjacency[i])){
-            int j = get(G->adjacency[i]);
-            fprintf(out,"%d",j);
-            if(position(G->adjacency[i])<length(G->adjacency[i])-1){ 
-                fprintf(out,", ");
+        bool first = true;
+        int lo, hi;
+        baseRange(G, toInternal(G, i), &lo, &hi);
+        for(int k = lo; k<hi; k++){
+            if(G->base->nbr[k]>0){
+                fprintf(out, first ? "%d" : ", %d", toExternal(G, G->base->nbr[k]));
+                first = false;
+            }
+        }
+        List L = G->adjacency[toInternal(G, i)];
+        for(moveFront(L); position(L)>=0; moveNext(L)){
+            if(get(L)<0){
+                continue;
             }
+            fprintf(out, first ? "%d" : ", %d", toExternal(G, get(L)));
+            first = false;
         }
         fprintf(out,")\n");
     }
+}
+
+// printMatrix()
+// Prints the rows x cols matrix M, stored row by row, to out. As text every
+// row is a line of comma separated values (CSV). In binary the ints rows and
+// cols are followed by the rows*cols entries of M, all in native byte order.
+void printMatrix(FILE* out, const int* M, int rows, int cols, bool binary){
+    if (out==NULL || (rows>0 && cols>0 && M==NULL)){
+        fprintf(stderr, "GRAPH ERROR: printMatrix(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if(binary){
+        int size[2] = {rows, cols};
+        fwrite(size, sizeof(int), 2, out);
+        fwrite(M, sizeof(int), (size_t)rows*cols, out);
+        return;
+    }
+    for(int i = 0; i<rows; i++){
+        for(int j = 0; j<cols; j++){
+            fprintf(out, (j>0) ? ",%d" : "%d", M[(long)i*cols+j]);
+        }
+        fprintf(out, "\n");
+    }
 }
\ No newline at end of file
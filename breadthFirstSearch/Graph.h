@@ -11,18 +11,44 @@
  #include <stdbool.h>
  #include <assert.h>
  #include "List.h"
+ #include "CSR.h"
  
  
  #define FORMAT "%d" 
 
+ // flags for newGraphFromEdges()
+ #define BUILD_DIRECTED 1
+ #define BUILD_SORT 2
+ #define BUILD_DEDUP 4
+
+ // getDist() of a vertex that BFSTo() stopped before reaching
+ #define UNKNOWN -3
+
+ // methods for reorderGraph()
+ #define ORDER_RCM 1
+ #define ORDER_BFS 2
+ #define ORDER_DEGREE 3
+
  typedef struct GraphObj*Graph;
 
+ // a BFS of a Graph that is run a slice at a time by BFSStep()
+ typedef struct BFSContextObj*BFSContext;
+
 
 
 // constructors - destructors -------------------------------------------------
 // newGraph()
 // Returns a Graph having n vertices and no edges.
 Graph newGraph(int n);
+// newGraphFromEdges()
+// Returns a Graph having n vertices and the m edges stored as pairs in
+// edges[0..2m-1]. The edges are undirected as with addEdge() unless flags
+// contains BUILD_DIRECTED, in which case they are arcs as with addArc().
+// BUILD_SORT sorts every adjacency list and BUILD_DEDUP also drops repeated
+// edges. Directed builds are always sorted, since addArc() inserts into a
+// sorted list. The adjacency is built on threads worker threads.
+// Pre: 1 <= edges[i] <= n
+Graph newGraphFromEdges(int n, const int* edges, int m, int flags, int threads);
 // freeGraph()
 // Frees all dynamic memory associated with Graph *pG and sets *pG to NULL.
 void freeGraph(Graph* pG);
@@ -47,30 +73,189 @@ int getSource(Graph G);
 int getParent(Graph G, int u);
 // getDist()
 // Returns the distance from the source vertex to u if BFS() has been called,
-// otherwise returns INF.
+// otherwise returns INF. After a BFSTo() that stopped early it returns
+// UNKNOWN for the vertices the search did not reach.
 // Pre: 1 <= u <= getOrder(G)
 int getDist(Graph G, int u);
+// newCSRFromGraph()
+// Returns a copy of the adjacency lists of G as a CSR on the vertex numbers
+// 1..getOrder(G). Every neighbor range keeps its adjacency list order.
+CSR newCSRFromGraph(Graph G);
 // getPath()
 // If vertex u is reachable from the source, appends the vertices of a shortest
 // source-u path to List L. Otherwise, appends NIL to L.
 // Pre: 1 <= u <= getOrder(G), getSource(G) != NIL
 void getPath(List L, Graph G, int u);
+// buildTranspose()
+// Builds the in-neighbor index of G in O(n+m) time on threads worker
+// threads, unless it is built already. Any change to the arcs of G drops the
+// index, and the functions that need it rebuild it on one thread.
+void buildTranspose(Graph G, int threads);
+// getInDegree()
+// Returns the number of arcs into vertex v, counting an edge from addEdge()
+// once. Pre: 1 <= v <= getOrder(G)
+int getInDegree(Graph G, int v);
+// getInNeighbors()
+// Appends to List L every vertex u with an arc u -> v, once per arc.
+// Pre: 1 <= v <= getOrder(G)
+void getInNeighbors(List L, Graph G, int v);
 // manipulation procedures ----------------------------------------------------
 // makeNull()
 // Resets G to its initial state.
 void makeNull(Graph G);
+// setIncremental()
+// If on is true, addEdge() and addArc() repair the tree of the most recent
+// BFS() so getParent(), getDist() and getPath() stay valid without another
+// call to BFS(). Only distances the new edge can improve are revisited. After
+// Dijkstra() the search is run again whenever a new arc shortens a path.
+void setIncremental(Graph G, bool on);
+// setDedup()
+// If on is true, addEdge() and addArc() ignore edges already in G, checked
+// through a hash set of arcs, and getNumEdges() counts only distinct edges.
+// Duplicates already in G when dedup is turned on are kept; build with
+// BUILD_DEDUP to drop those. If on is false, the hash set is dropped.
+void setDedup(Graph G, bool on);
+// setHybrid()
+// If on is true, freezes the adjacency lists of G into a CSR base and keeps
+// later insertions in per-vertex delta lists. BFS() walks both, and the
+// deltas are merged into a new base once they pass 1/8 of the graph, so an
+// insertion costs O(1) amortized while searches run at near CSR speed.
+// addArc() appends to the delta list instead of keeping neighbors sorted.
+// If on is false, the base is moved back into the adjacency lists.
+void setHybrid(Graph G, bool on);
 // addEdge()
-// Creates an undirected edge joining vertex u to vertex v.
+// Creates an undirected edge joining vertex u to vertex v. In a weighted
+// graph it has weight 1.
 // Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
 void addEdge(Graph G, int u, int v);
 // addArc()
-// Creates a directed edge joining vertex u to vertex v.
+// Creates a directed edge joining vertex u to vertex v. In a weighted graph
+// it has weight 1.
 // Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
 void addArc(Graph G, int u, int v);
+// addWeightedEdge()
+// Creates an undirected edge of weight w joining vertex u to vertex v. The
+// first weighted edge or arc gives every earlier arc of G weight 1.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G), w >= 0
+void addWeightedEdge(Graph G, int u, int v, int w);
+// addWeightedArc()
+// Creates a directed edge of weight w joining vertex u to vertex v. The
+// first weighted edge or arc gives every earlier arc of G weight 1.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G), w >= 0
+void addWeightedArc(Graph G, int u, int v, int w);
+// removeEdge()
+// Deletes one undirected edge joining vertex u to vertex v. Returns false if
+// there is no such edge. The neighbors are marked dead in place and a list is
+// compacted once a quarter of it is dead. With setIncremental() on, a BFS
+// tree that used the edge is rebuilt.
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
+bool removeEdge(Graph G, int u, int v);
+// removeArc()
+// Deletes one directed edge joining vertex u to vertex v. Returns false if
+// there is no such edge. Tombstones and tree repair work as in removeEdge().
+// Pre: 1 <= u <= getOrder(G), 1 <= v <= getOrder(G)
+bool removeArc(Graph G, int u, int v);
+// compactGraph()
+// Rewrites every adjacency list of G that holds tombstones, so that a caller
+// can pay for compaction at a quiet time instead of during removals.
+void compactGraph(Graph G);
 // BFS()
 // Runs the Breadth First Search algorithm on G with source vertex s.
 void BFS(Graph G, int s);
+// BFSTo()
+// Runs BFS() on G from source vertex s but stops as soon as t is reached.
+// Parents and distances are valid for every vertex reached, so getPath(L,
+// G, t) gives a shortest s-t path. If the search stopped early, getDist()
+// returns UNKNOWN for the vertices it did not reach. Only the vertices the
+// previous BFSTo() reached are reset, so a nearby t costs only what the
+// search touches.
+// Pre: 1 <= s <= getOrder(G), 1 <= t <= getOrder(G)
+void BFSTo(Graph G, int s, int t);
+// BFSBegin()
+// Returns a context for a BFS of G from source vertex s that BFSStep() runs
+// a slice at a time. Results are kept in the context, not in G, so several
+// searches can be interleaved. Starting costs no pass over the vertices.
+// Pre: 1 <= s <= getOrder(G), G is not changed until BFSDone()
+BFSContext BFSBegin(Graph G, int s);
+// BFSStep()
+// Continues the search of C, scanning at most maxEdges arcs, or every
+// remaining arc if maxEdges <= 0. Returns true once the search is done. A
+// neighbor list is copied into C before it is scanned, so a slice that stops
+// in the middle of it resumes in constant time and the cursors of G are never
+// moved. Contexts over the same G can be stepped from different threads.
+bool BFSStep(BFSContext C, long maxEdges);
+// getSearchDist()
+// Returns the distance from the source of C to u if the search has reached
+// u, INF if it is done without reaching u, and UNKNOWN otherwise.
+// Pre: 1 <= u <= getOrder(G)
+int getSearchDist(BFSContext C, int u);
+// getSearchParent()
+// Returns the parent of u in the BFS tree of C, or NIL if u is the source
+// or has not been reached. Pre: 1 <= u <= getOrder(G)
+int getSearchParent(BFSContext C, int u);
+// BFSDone()
+// Frees heap memory associated with *pC, sets *pC to NULL. The search may
+// be finished or not.
+void BFSDone(BFSContext* pC);
+// BFSReverse()
+// Runs BFS() on G with every arc reversed, from source vertex s, through the
+// in-neighbor index. Afterwards getDist(G, u) is the distance from u to s,
+// getParent(G, u) is the next vertex on a shortest u-s path, and getPath()
+// lists such a path from s back to u. Arc weights are ignored.
+void BFSReverse(Graph G, int s);
+// kHopNeighbors()
+// Writes the vertices at distance 1..k from u into out, in order of
+// distance, and their distances into dist unless it is NULL. Returns how
+// many were written. The search stops early once cap vertices are found or
+// once budget arcs have been scanned, if budget > 0, and then the result is
+// the start of the full answer. Visit marks are epoch stamps, so a query
+// costs only what it touches and leaves the BFS() results of G alone.
+// Pre: 1 <= u <= getOrder(G), k >= 0, out and dist have room for cap ints
+int kHopNeighbors(Graph G, int u, int k, int* out, int* dist, int cap, long budget);
+// distanceMatrix()
+// Sets M[i*nt+j] to the distance from S[i] to T[j], or to INF (-1) if T[j]
+// cannot be reached, for 0 <= i < ns and 0 <= j < nt. Runs one BFS per
+// source on a CSR copy of G, stopping once every target is reached, with
+// the sources shared by threads worker threads. The BFS() results of G are
+// left alone.
+// Pre: 1 <= S[i], T[j] <= getOrder(G), M has room for ns*nt ints
+void distanceMatrix(Graph G, const int* S, int ns, const int* T, int nt, int* M, int threads);
+// Dijkstra()
+// Runs Dijkstra's algorithm on G from source vertex s with an indexed 4-ary
+// heap. Afterwards getDist() is the weight of a lightest path, and getParent()
+// and getPath() follow lightest paths. An unweighted G has weight 1 arcs.
+// Pre: 1 <= s <= getOrder(G)
+void Dijkstra(Graph G, int s);
+// DijkstraRadix()
+// Same as Dijkstra(), but with a monotone radix heap, which does less work
+// per operation when the weights are small integers.
+// Pre: 1 <= s <= getOrder(G)
+void DijkstraRadix(Graph G, int s);
+// BFS01()
+// Same as Dijkstra() for a G whose arcs all weigh 0 or 1, in O(n+m) time. A
+// deque replaces the heap: weight 0 arcs put their end in front and weight 1
+// arcs put it in back. Pre: 1 <= s <= getOrder(G), no arc weighs more than 1
+void BFS01(Graph G, int s);
+// Dial()
+// Same as Dijkstra() with Dial's bucket queue: a ring of C+1 buckets, C the
+// largest arc weight, where bucket d % (C+1) holds the vertices at distance
+// d. Runs in O(n+m+D) time, D the largest distance, so it suits small
+// integer weights. Pre: 1 <= s <= getOrder(G)
+void Dial(Graph G, int s);
+// reorderGraph()
+// Relabels the internal vertices of G so that vertices that are searched
+// together sit together in memory. method is one of ORDER_RCM (Reverse
+// Cuthill-McKee), ORDER_BFS (breadth first discovery order) or ORDER_DEGREE
+// (decreasing degree). Vertex numbers passed to and returned by every other
+// function are unchanged, as are the order of each adjacency list and the
+// results of the most recent BFS().
+void reorderGraph(Graph G, int method);
 // other functions ------------------------------------------------------------
 // printGraph()
 // Prints the adjacency list representation of G to FILE* out.
-void printGraph(FILE* out, Graph G);
\ No newline at end of file
+void printGraph(FILE* out, Graph G);
+// printMatrix()
+// Prints the rows x cols matrix M, stored row by row, to out. As text every
+// row is a line of comma separated values (CSV). In binary the ints rows and
+// cols are followed by the rows*cols entries of M, all in native byte order.
+void printMatrix(FILE* out, const int* M, int rows, int cols, bool binary);
\ No newline at end of file
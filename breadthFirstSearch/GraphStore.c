@@ -0,0 +1,402 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * GraphStore.c
+ * Definition of GraphStore.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <stdatomic.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "GraphStore.h"
+
+#define INF -1
+
+// Vertices are grouped into blocks of 2^BLOCK_SHIFT consecutive vertex
+// numbers. A version shares every block it did not change with the version
+// before it, and a block is never modified once it has been published.
+#define BLOCK_SHIFT 6
+#define VERTEX_BLOCK (1<<BLOCK_SHIFT)
+
+typedef struct vblock{
+    int offset[VERTEX_BLOCK+1];     // vertex (b<<BLOCK_SHIFT)+i has neighbors
+    int nbr[];                      // nbr[offset[i]] .. nbr[offset[i+1]-1]
+} vblock;
+
+typedef struct SnapshotObj{
+    int version;
+    int n;
+    int blocks;
+    vblock* block[];
+} SnapshotObj;
+
+// Memory that a reader may still be using. It is freed once every pinned
+// reader entered after epoch.
+typedef struct retired{
+    void* p;
+    long epoch;
+    struct retired* next;
+} retired;
+
+typedef struct GraphStoreObj{
+    _Atomic(SnapshotObj*) current;
+    atomic_long epoch;
+    atomic_long* pinned;    // epoch reader r pinned at, or 0 if r is idle
+    int readers;
+    retired* limbo;         // the rest belongs to the writer alone
+    int* extra;             // new neighbors per vertex, 0 between publishes
+    int* cursor;            // next free slot of each vertex in its new block
+    int* touched;           // blocks changed by the current publish
+    bool* changed;
+} GraphStoreObj;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// degreeIn()
+// Returns the number of neighbors of vertex i of block B, or 0 if B is NULL.
+static int degreeIn(const vblock* B, int i){
+    return (B==NULL) ? 0 : B->offset[i+1]-B->offset[i];
+}
+
+// growBlock()
+// Returns a copy of block b of old with room for S->extra[u] more neighbors
+// after the current ones of every vertex u, and points S->cursor[u] at that
+// room.
+static vblock* growBlock(GraphStore S, const vblock* old, int b, int n){
+    int first = b<<BLOCK_SHIFT;
+    int m = 0;
+    for(int i = 0; i<VERTEX_BLOCK; i++){
+        int u = first+i;
+        m += degreeIn(old, i) + ((u>=1 && u<=n) ? S->extra[u] : 0);
+    }
+    vblock* B = malloc(sizeof(vblock) + m*sizeof(int));
+    assert(B!=NULL && "ERROR: growBlock(): out of memory");
+    int k = 0;
+    for(int i = 0; i<VERTEX_BLOCK; i++){
+        int u = first+i;
+        int d = degreeIn(old, i);
+        B->offset[i] = k;
+        if(d>0){
+            memcpy(B->nbr+k, old->nbr+old->offset[i], d*sizeof(int));
+        }
+        k += d;
+        if(u>=1 && u<=n){
+            S->cursor[u] = k;
+            k += S->extra[u];
+        }
+    }
+    B->offset[VERTEX_BLOCK] = k;
+    return B;
+}
+
+// newGraphStore()
+// Returns a store whose first version holds the edges of G, with room for
+// the given number of reader slots. Later changes to G are not seen.
+// Pre: readers >= 1
+GraphStore newGraphStore(Graph G, int readers){
+    if(G==NULL){
+        fprintf(stderr, "GraphStore ERROR: newGraphStore(): NULL Graph\n");
+        exit(EXIT_FAILURE);
+    }
+    if(readers<1){
+        fprintf(stderr, "GraphStore ERROR: newGraphStore(): no reader slots\n");
+        exit(EXIT_FAILURE);
+    }
+    int n = getOrder(G);
+    int blocks = (n>>BLOCK_SHIFT)+1;
+    GraphStore S = malloc(sizeof(GraphStoreObj));
+    SnapshotObj* V = malloc(sizeof(SnapshotObj) + blocks*sizeof(vblock*));
+    assert(S!=NULL && V!=NULL && "ERROR: newGraphStore(): out of memory");
+    S->pinned = malloc(readers*sizeof(atomic_long));
+    S->extra = calloc(n+1, sizeof(int));
+    S->cursor = calloc(n+1, sizeof(int));
+    S->touched = calloc(blocks, sizeof(int));
+    S->changed = calloc(blocks, sizeof(bool));
+    assert(S->pinned!=NULL && S->extra!=NULL && S->cursor!=NULL && S->touched!=NULL
+           && S->changed!=NULL && "ERROR: newGraphStore(): out of memory");
+    for(int r = 0; r<readers; r++){
+        atomic_init(&S->pinned[r], 0);
+    }
+    S->readers = readers;
+    S->limbo = NULL;
+    atomic_init(&S->epoch, 1);
+
+    // the first version is every block grown from nothing
+    CSR C = newCSRFromGraph(G);
+    for(int u = 1; u<=n; u++){
+        S->extra[u] = C->offset[u+1]-C->offset[u];
+    }
+    V->version = 0;
+    V->n = n;
+    V->blocks = blocks;
+    for(int b = 0; b<blocks; b++){
+        V->block[b] = growBlock(S, NULL, b, n);
+    }
+    for(int u = 1; u<=n; u++){
+        vblock* B = V->block[u>>BLOCK_SHIFT];
+        memcpy(B->nbr+S->cursor[u], C->nbr+C->offset[u], S->extra[u]*sizeof(int));
+        S->extra[u] = 0;
+    }
+    freeCSR(&C);
+    atomic_init(&S->current, V);
+    return S;
+}
+
+// freeGraphStore()
+// Frees heap memory associated with *pS, sets *pS to NULL.
+// Pre: no snapshot of *pS is pinned
+void freeGraphStore(GraphStore* pS){
+    if(pS!=NULL && *pS!=NULL){
+        GraphStore S = *pS;
+        SnapshotObj* V = atomic_load(&S->current);
+        for(int b = 0; b<V->blocks; b++){
+            free(V->block[b]);
+        }
+        free(V);
+        while(S->limbo!=NULL){
+            retired* R = S->limbo;
+            S->limbo = R->next;
+            free(R->p);
+            free(R);
+        }
+        free(S->pinned);
+        free(S->extra);
+        free(S->cursor);
+        free(S->touched);
+        free(S->changed);
+        free(S);
+        *pS = NULL;
+    }
+}
+
+// Access functions -----------------------------------------------------------
+
+// pinSnapshot()
+// Returns the current version of S for reader slot r. It is never changed or
+// freed until unpinSnapshot(S, r) is called. A slot pins one version at a time.
+// Pre: 0 <= r < readers, slot r has nothing pinned
+Snapshot pinSnapshot(GraphStore S, int r){
+    if(S==NULL){
+        fprintf(stderr, "GraphStore ERROR: pinSnapshot(): NULL GraphStore\n");
+        exit(EXIT_FAILURE);
+    }
+    if(r<0 || r>=S->readers){
+        fprintf(stderr, "GraphStore ERROR: pinSnapshot(): no reader slot %d\n", r);
+        exit(EXIT_FAILURE);
+    }
+    // announcing the epoch before loading the version means any version
+    // retired at or after that epoch waits for this reader
+    atomic_store(&S->pinned[r], atomic_load(&S->epoch));
+    return atomic_load(&S->current);
+}
+
+// unpinSnapshot()
+// Releases the version pinned by reader slot r.
+void unpinSnapshot(GraphStore S, int r){
+    if(S==NULL){
+        fprintf(stderr, "GraphStore ERROR: unpinSnapshot(): NULL GraphStore\n");
+        exit(EXIT_FAILURE);
+    }
+    if(r<0 || r>=S->readers){
+        fprintf(stderr, "GraphStore ERROR: unpinSnapshot(): no reader slot %d\n", r);
+        exit(EXIT_FAILURE);
+    }
+    atomic_store(&S->pinned[r], 0);
+}
+
+// snapshotVersion()
+// Returns the number of V, which is 0 for the first version of a store and
+// one more for every later version.
+int snapshotVersion(Snapshot V){
+    if(V==NULL){
+        fprintf(stderr, "GraphStore ERROR: snapshotVersion(): NULL Snapshot\n");
+        exit(EXIT_FAILURE);
+    }
+    return V->version;
+}
+
+// snapshotOrder()
+// Returns the number of vertices of V.
+int snapshotOrder(Snapshot V){
+    if(V==NULL){
+        fprintf(stderr, "GraphStore ERROR: snapshotOrder(): NULL Snapshot\n");
+        exit(EXIT_FAILURE);
+    }
+    return V->n;
+}
+
+// snapshotNeighbors()
+// Sets *nbr to the neighbors of u in V and returns how many there are.
+// Pre: 1 <= u <= snapshotOrder(V)
+int snapshotNeighbors(Snapshot V, int u, const int** nbr){
+    if(V==NULL){
+        fprintf(stderr, "GraphStore ERROR: snapshotNeighbors(): NULL Snapshot\n");
+        exit(EXIT_FAILURE);
+    }
+    if(u<1 || u>V->n){
+        fprintf(stderr, "GraphStore ERROR: snapshotNeighbors(): vertex out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    const vblock* B = V->block[u>>BLOCK_SHIFT];
+    int i = u & (VERTEX_BLOCK-1);
+    *nbr = B->nbr + B->offset[i];
+    return B->offset[i+1]-B->offset[i];
+}
+
+// snapshotBFS()
+// Sets dist[u] to the distance from s to u in V, or to -1 if u cannot be
+// reached, for every 1 <= u <= snapshotOrder(V).
+// Pre: 1 <= s <= snapshotOrder(V), dist has snapshotOrder(V)+1 entries
+void snapshotBFS(Snapshot V, int s, int* dist){
+    if(V==NULL){
+        fprintf(stderr, "GraphStore ERROR: snapshotBFS(): NULL Snapshot\n");
+        exit(EXIT_FAILURE);
+    }
+    if(s<1 || s>V->n){
+        fprintf(stderr, "GraphStore ERROR: snapshotBFS(): invalid source vertex\n");
+        exit(EXIT_FAILURE);
+    }
+    int* queue = malloc((V->n+1)*sizeof(int));
+    assert(queue!=NULL && "ERROR: snapshotBFS(): out of memory");
+    for(int u = 1; u<=V->n; u++){
+        dist[u] = INF;
+    }
+    int head = 0, tail = 0;
+    dist[s] = 0;
+    queue[tail++] = s;
+    while(head<tail){
+        int x = queue[head++];
+        const vblock* B = V->block[x>>BLOCK_SHIFT];
+        int i = x & (VERTEX_BLOCK-1);
+        for(int j = B->offset[i]; j<B->offset[i+1]; j++){
+            int y = B->nbr[j];
+            if(dist[y]==INF){
+                dist[y] = dist[x]+1;
+                queue[tail++] = y;
+            }
+        }
+    }
+    free(queue);
+}
+
+// Manipulation procedures ----------------------------------------------------
+
+// retire()
+// Puts p in limbo until no reader can hold it. e is the epoch it was
+// unpublished at.
+static void retire(GraphStore S, void* p, long e){
+    retired* R = malloc(sizeof(retired));
+    assert(R!=NULL && "ERROR: retire(): out of memory");
+    R->p = p;
+    R->epoch = e;
+    R->next = S->limbo;
+    S->limbo = R;
+}
+
+// reclaim()
+// Frees everything in limbo that was retired before the oldest epoch still
+// pinned by a reader.
+static void reclaim(GraphStore S){
+    long oldest = atomic_load(&S->epoch);
+    for(int r = 0; r<S->readers; r++){
+        long e = atomic_load(&S->pinned[r]);
+        if(e!=0 && e<oldest){
+            oldest = e;
+        }
+    }
+    retired** link = &S->limbo;
+    while(*link!=NULL){
+        retired* R = *link;
+        if(R->epoch<oldest){
+            *link = R->next;
+            free(R->p);
+            free(R);
+        }else{
+            link = &R->next;
+        }
+    }
+}
+
+// countArc()
+// First pass of publishEdges(): counts one more neighbor of u and notes the
+// block of u as changed.
+static void countArc(GraphStore S, int u, int* t){
+    int b = u>>BLOCK_SHIFT;
+    S->extra[u]++;
+    if(!S->changed[b]){
+        S->changed[b] = true;
+        S->touched[(*t)++] = b;
+    }
+}
+
+// publishEdges()
+// Publishes a new version of S holding every edge of the current one plus
+// the m edges stored as pairs in edges[0..2m-1], as arcs if directed is true
+// and as undirected edges otherwise. Only the blocks of vertices that gain
+// neighbors are copied; the rest are shared with the previous version, which
+// is freed once no reader can still hold it. Only one thread may publish.
+// Pre: 1 <= edges[i] <= n
+void publishEdges(GraphStore S, const int* edges, int m, bool directed){
+    if(S==NULL){
+        fprintf(stderr, "GraphStore ERROR: publishEdges(): NULL GraphStore\n");
+        exit(EXIT_FAILURE);
+    }
+    SnapshotObj* old = atomic_load(&S->current);
+    int n = old->n;
+    for(int i = 0; i<2*m; i++){
+        if(edges[i]<1 || edges[i]>n){
+            fprintf(stderr, "GraphStore ERROR: publishEdges(): edge %d has an endpoint "
+                    "out of range\n", i/2);
+            exit(EXIT_FAILURE);
+        }
+    }
+    int t = 0;
+    for(int i = 0; i<m; i++){
+        countArc(S, edges[2*i], &t);
+        if(!directed){
+            countArc(S, edges[2*i+1], &t);
+        }
+    }
+
+    SnapshotObj* V = malloc(sizeof(SnapshotObj) + old->blocks*sizeof(vblock*));
+    assert(V!=NULL && "ERROR: publishEdges(): out of memory");
+    V->version = old->version+1;
+    V->n = n;
+    V->blocks = old->blocks;
+    memcpy(V->block, old->block, old->blocks*sizeof(vblock*));
+    for(int j = 0; j<t; j++){
+        int b = S->touched[j];
+        V->block[b] = growBlock(S, old->block[b], b, n);
+    }
+    for(int i = 0; i<m; i++){
+        int u = edges[2*i];
+        int v = edges[2*i+1];
+        V->block[u>>BLOCK_SHIFT]->nbr[S->cursor[u]++] = v;
+        if(!directed){
+            V->block[v>>BLOCK_SHIFT]->nbr[S->cursor[v]++] = u;
+        }
+    }
+
+    // readers that pin after the epoch moves on are sure to see V
+    atomic_store(&S->current, V);
+    long e = atomic_fetch_add(&S->epoch, 1);
+    retire(S, old, e);
+    for(int j = 0; j<t; j++){
+        int b = S->touched[j];
+        retire(S, old->block[b], e);
+        S->changed[b] = false;
+        for(int i = 0; i<VERTEX_BLOCK; i++){
+            int u = (b<<BLOCK_SHIFT)+i;
+            if(u>=1 && u<=n){
+                S->extra[u] = 0;
+            }
+        }
+    }
+    reclaim(S);
+}
@@ -0,0 +1,79 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * GraphStore.h
+ * Header file for versioned graph snapshot functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// Exported Types -------------------------------------------------------------
+
+// A GraphStore holds a sequence of immutable versions of a graph on the
+// vertices 1..n. One writer thread publishes new versions while any number of
+// reader threads, each with its own slot 0..readers-1, search pinned ones.
+typedef struct GraphStoreObj* GraphStore;
+
+// An immutable version of the graph. It stays valid until it is unpinned.
+typedef const struct SnapshotObj* Snapshot;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newGraphStore()
+// Returns a store whose first version holds the edges of G, with room for
+// the given number of reader slots. Later changes to G are not seen.
+// Pre: readers >= 1
+GraphStore newGraphStore(Graph G, int readers);
+
+// freeGraphStore()
+// Frees heap memory associated with *pS, sets *pS to NULL.
+// Pre: no snapshot of *pS is pinned
+void freeGraphStore(GraphStore* pS);
+
+// Access functions -----------------------------------------------------------
+
+// pinSnapshot()
+// Returns the current version of S for reader slot r. It is never changed or
+// freed until unpinSnapshot(S, r) is called. A slot pins one version at a time.
+// Pre: 0 <= r < readers, slot r has nothing pinned
+Snapshot pinSnapshot(GraphStore S, int r);
+
+// unpinSnapshot()
+// Releases the version pinned by reader slot r.
+void unpinSnapshot(GraphStore S, int r);
+
+// snapshotVersion()
+// Returns the number of V, which is 0 for the first version of a store and
+// one more for every later version.
+int snapshotVersion(Snapshot V);
+
+// snapshotOrder()
+// Returns the number of vertices of V.
+int snapshotOrder(Snapshot V);
+
+// snapshotNeighbors()
+// Sets *nbr to the neighbors of u in V and returns how many there are.
+// Pre: 1 <= u <= snapshotOrder(V)
+int snapshotNeighbors(Snapshot V, int u, const int** nbr);
+
+// snapshotBFS()
+// Sets dist[u] to the distance from s to u in V, or to -1 if u cannot be
+// reached, for every 1 <= u <= snapshotOrder(V).
+// Pre: 1 <= s <= snapshotOrder(V), dist has snapshotOrder(V)+1 entries
+void snapshotBFS(Snapshot V, int s, int* dist);
+
+// Manipulation procedures ----------------------------------------------------
+
+// publishEdges()
+// Publishes a new version of S holding every edge of the current one plus
+// the m edges stored as pairs in edges[0..2m-1], as arcs if directed is true
+// and as undirected edges otherwise. Only the blocks of vertices that gain
+// neighbors are copied; the rest are shared with the previous version, which
+// is freed once no reader can still hold it. Only one thread may publish.
+// Pre: 1 <= edges[i] <= n
+void publishEdges(GraphStore S, const int* edges, int m, bool directed);
@@ -8,6 +8,13 @@
 
  #include "List.h"
  #include "Graph.h"
+ #include "Components.h"
+ #include "Reach.h"
+#include "GraphStore.h"
+#include "Centrality.h"
+#include "Diameter.h"
+#include "PageRank.h"
+#include "ExternalBFS.h"
 
 int main(void){
     Graph G = newGraph(5);
@@ -42,6 +49,224 @@ int main(void){
     fprintf(stdout,"Source: %d\nParent of 5: %d\nDistance to 3: %d\nDistance to 5: %d\n",i,j,k,l);
     
     freeGraph(&G);
+
+    int edges[] = {1,2, 1,3, 2,4, 2,5, 2,6, 3,4, 4,5, 5,6, 2,1, 6,5};
+    G = newGraphFromEdges(6, edges, 10, BUILD_DEDUP, 4);
+    printGraph(stdout, G);
+    fprintf(stdout,"Edges: %d\n", getNumEdges(G));
+
+    reorderGraph(G, ORDER_RCM);
+    printGraph(stdout, G);
+    BFS(G, 3);
+    fprintf(stdout,"Source: %d\nParent of 6: %d\nDistance to 6: %d\n",
+            getSource(G), getParent(G,6), getDist(G,6));
+
+    setIncremental(G, true);
+    addEdge(G, 3, 6);
+    fprintf(stdout,"Parent of 6: %d\nDistance to 6: %d\nDistance to 5: %d\n",
+            getParent(G,6), getDist(G,6), getDist(G,5));
+    freeGraph(&G);
+
+    G = newGraph(4);
+    setDedup(G, true);
+    addEdge(G, 1, 2);
+    addEdge(G, 2, 1);
+    addEdge(G, 1, 2);
+    addArc(G, 3, 4);
+    addArc(G, 3, 4);
+    addArc(G, 4, 3);
+    fprintf(stdout,"Distinct edges: %d\n", getNumEdges(G));
+    printGraph(stdout, G);
+    removeEdge(G, 2, 1);
+    removeArc(G, 3, 4);
+    fprintf(stdout,"Removed 1-2 again: %d\n", removeEdge(G, 1, 2));
+    addEdge(G, 1, 2);
+    fprintf(stdout,"Edges after removal: %d\n", getNumEdges(G));
+    printGraph(stdout, G);
+    freeGraph(&G);
+
+    G = newGraph(3);
+    addEdge(G, 1, 2);
+    addEdge(G, 1, 2);
+    setDedup(G, true);
+    removeEdge(G, 1, 2);
+    addEdge(G, 1, 2);
+    fprintf(stdout,"Edges after removing a copy kept by dedup: %d\n", getNumEdges(G));
+    printGraph(stdout, G);
+    freeGraph(&G);
+
+    G = newGraph(5);
+    addEdge(G, 1, 2);
+    addEdge(G, 2, 3);
+    setHybrid(G, true);
+    addEdge(G, 3, 4);
+    addArc(G, 4, 5);
+    removeEdge(G, 1, 2);
+    addEdge(G, 1, 3);
+    BFS(G, 1);
+    fprintf(stdout,"Hybrid distance to 5: %d\n", getDist(G, 5));
+    printGraph(stdout, G);
+    setHybrid(G, false);
+    printGraph(stdout, G);
+    freeGraph(&G);
+
+    G = newGraph(5);
+    addWeightedEdge(G, 1, 2, 7);
+    addWeightedEdge(G, 1, 3, 2);
+    addWeightedEdge(G, 3, 2, 3);
+    addWeightedArc(G, 2, 4, 1);
+    addArc(G, 4, 5);
+    Dijkstra(G, 1);
+    List P = newList();
+    getPath(P, G, 5);
+    fprintf(stdout,"Weighted distance to 5: %d\nLightest path: ", getDist(G, 5));
+    printList(stdout, P);
+    DijkstraRadix(G, 1);
+    fprintf(stdout,"Radix heap distance to 5: %d\n", getDist(G, 5));
+    Dial(G, 1);
+    fprintf(stdout,"Bucket queue distance to 5: %d\n", getDist(G, 5));
+    freeGraph(&G);
+
+    G = newGraph(5);
+    addWeightedArc(G, 1, 2, 1);
+    addWeightedArc(G, 2, 3, 1);
+    addWeightedArc(G, 1, 4, 0);
+    addWeightedArc(G, 4, 3, 0);
+    addWeightedArc(G, 3, 5, 1);
+    BFS01(G, 1);
+    clear(P);
+    getPath(P, G, 5);
+    fprintf(stdout,"0-1 distance to 5: %d\n0-1 path: ", getDist(G, 5));
+    printList(stdout, P);
+    freeList(&P);
+    freeGraph(&G);
+
+    G = newGraph(5);
+    addEdge(G, 1, 2);
+    addEdge(G, 2, 3);
+    addEdge(G, 3, 4);
+    addEdge(G, 3, 5);
+    double score[6];
+    betweenness(G, score, 0, 2);
+    for(int u = 1; u<=5; u++){
+        fprintf(stdout,"Betweenness of %d: %.1f\n", u, score[u]);
+    }
+    int lower[6], upper[6];
+    fprintf(stdout,"Diameter: %d\n", graphDiameter(G));
+    fprintf(stdout,"Exact eccentricities after 2 sweeps: %d\n",
+            eccentricityBounds(G, lower, upper, 2));
+    for(int u = 1; u<=5; u++){
+        fprintf(stdout,"Eccentricity of %d: %d..%d\n", u, lower[u], upper[u]);
+    }
+    int iterations = pageRank(G, score, 0.85, 1e-6, 100, 2);
+    fprintf(stdout,"PageRank converged: %s\n", iterations<100 ? "yes" : "no");
+    for(int u = 1; u<=5; u++){
+        fprintf(stdout,"PageRank of %d: %.4f\n", u, score[u]);
+    }
+    personalizedPageRank(G, 1, score, 0.85, 1e-9);
+    for(int u = 1; u<=5; u++){
+        fprintf(stdout,"PageRank of %d from 1: %.4f\n", u, score[u]);
+    }
+    int near[5], hops[5];
+    int found = kHopNeighbors(G, 1, 2, near, hops, 5, 0);
+    fprintf(stdout,"Within 2 hops of 1:");
+    for(int u = 0; u<found; u++){
+        fprintf(stdout," %d (%d)", near[u], hops[u]);
+    }
+    found = kHopNeighbors(G, 1, 3, near, hops, 5, 2);
+    fprintf(stdout,"\nWithin 3 hops of 1, 2 arcs scanned: %d found\n", found);
+    BFSTo(G, 1, 2);
+    fprintf(stdout,"Early exit distance to 2: %d\nDistance to 4 after early exit: %d\n",
+            getDist(G, 2), getDist(G, 4));
+    BFSTo(G, 1, 5);
+    fprintf(stdout,"Early exit distance to 5: %d\n", getDist(G, 5));
+    BFSContext search = BFSBegin(G, 1);
+    int slices = 1;
+    while(!BFSStep(search, 2)){
+        if(slices==1){
+            fprintf(stdout,"After one slice, distance to 5: %d\n", getSearchDist(search, 5));
+        }
+        slices++;
+    }
+    fprintf(stdout,"Slices: %d\nSliced distance to 5: %d\nParent of 5: %d\n", slices,
+            getSearchDist(search, 5), getSearchParent(search, 5));
+    BFSDone(&search);
+    FILE* disk = tmpfile();
+    FILE* levels = tmpfile();
+    writeGraphFile(G, disk);
+    long reached = externalBFS(disk, 1, levels, 64);
+    fprintf(stdout,"External BFS reached: %ld\nExternal distances:", reached);
+    rewind(levels);
+    int pair[2];
+    while(fread(pair, sizeof(int), 2, levels)==2){
+        fprintf(stdout," %d (%d)", pair[0], pair[1]);
+    }
+    fprintf(stdout,"\n");
+    fclose(levels);
+    fclose(disk);
+    freeGraph(&G);
+
+    G = newGraph(6);
+    addArc(G, 1, 2);
+    addArc(G, 2, 3);
+    addArc(G, 3, 1);
+    addArc(G, 3, 4);
+    addArc(G, 4, 5);
+    addArc(G, 5, 4);
+    addArc(G, 6, 5);
+    int comp[7];
+    int c = stronglyConnectedComponents(G, comp);
+    fprintf(stdout,"Components: %d\n", c);
+    for(int u = 1; u<=6; u++){
+        fprintf(stdout,"%d is in component %d\n", u, comp[u]);
+    }
+    Graph D = condensation(G, comp, c);
+    printGraph(stdout, D);
+    freeGraph(&D);
+    int size[7];
+    c = connectedComponents(G, comp, size, 4);
+    fprintf(stdout,"Connected components: %d\n", c);
+    for(int u = 1; u<=c; u++){
+        fprintf(stdout,"Component %d has %d vertices\n", u, size[u]);
+    }
+    buildTranspose(G, 2);
+    List In = newList();
+    getInNeighbors(In, G, 5);
+    fprintf(stdout,"In-degree of 5: %d\nIn-neighbors of 5: ", getInDegree(G, 5));
+    printList(stdout, In);
+    BFSReverse(G, 5);
+    for(int u = 1; u<=6; u++){
+        fprintf(stdout,"Distance from %d to 5: %d\n", u, getDist(G, u));
+    }
+    clear(In);
+    getPath(In, G, 1);
+    fprintf(stdout,"Path from 5 back to 1: ");
+    printList(stdout, In);
+    freeList(&In);
+    int from[] = {1, 4, 6}, to[] = {2, 5, 6};
+    int M[9];
+    distanceMatrix(G, from, 3, to, 3, M, 2);
+    fprintf(stdout,"Distance matrix:\n");
+    printMatrix(stdout, M, 3, 3, false);
+    GraphStore S = newGraphStore(G, 2);
+    Snapshot V0 = pinSnapshot(S, 0);
+    int more[] = {5, 6, 1, 6};
+    publishEdges(S, more, 2, true);
+    Snapshot V1 = pinSnapshot(S, 1);
+    int dist0[7], dist1[7];
+    snapshotBFS(V0, 1, dist0);
+    snapshotBFS(V1, 1, dist1);
+    fprintf(stdout,"Version %d distance 1 to 6: %d\nVersion %d distance 1 to 6: %d\n",
+            snapshotVersion(V0), dist0[6], snapshotVersion(V1), dist1[6]);
+    unpinSnapshot(S, 0);
+    unpinSnapshot(S, 1);
+    freeGraphStore(&S);
+    Reach R = newReach(G, 2);
+    fprintf(stdout,"1 reaches 5: %d\n5 reaches 1: %d\n6 reaches 2: %d\n",
+            canReach(R,1,5), canReach(R,5,1), canReach(R,6,2));
+    freeReach(&R);
+    freeGraph(&G);
+
 //    printGraph(stdout,G);
 //    makeNull(G);
     printGraph(stdout,G);
@@ -0,0 +1,354 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Heap.c
+ * Definition of Heap.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Heap.h"
+
+#define ARITY 4
+#define BUCKETS 33
+
+typedef struct HeapObj{
+    int n;
+    int size;
+    int* item;      // item[0..size-1] in heap order
+    int* pos;       // pos[v] is the index of v in item, or -1
+    int* key;
+} HeapObj;
+
+typedef struct entry{
+    int v;
+    int k;
+} entry;
+
+typedef struct bucket{
+    entry* e;
+    int size;
+    int capacity;
+} bucket;
+
+typedef struct RadixHeapObj{
+    int n;
+    int live;           // items whose newest entry is still in a bucket
+    int last;           // last key popped
+    int* key;           // newest key of v, or -1 if v is not in R
+    bucket b[BUCKETS];  // b[0] holds key last, b[i] keys differing in bit i-1
+} RadixHeapObj;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newHeap()
+// Returns an empty heap for the items 1..n.
+Heap newHeap(int n){
+    Heap H = malloc(sizeof(HeapObj));
+    assert(H!=NULL && "ERROR: newHeap(): out of memory");
+    H->n = n;
+    H->size = 0;
+    H->item = malloc((n+1)*sizeof(int));
+    H->pos = malloc((n+1)*sizeof(int));
+    H->key = malloc((n+1)*sizeof(int));
+    assert(H->item!=NULL && H->pos!=NULL && H->key!=NULL && "ERROR: newHeap(): out of memory");
+    for(int v = 0; v<=n; v++){
+        H->pos[v] = -1;
+    }
+    return H;
+}
+
+// freeHeap()
+// Frees heap memory associated with *pH, sets *pH to NULL.
+void freeHeap(Heap* pH){
+    if(pH!=NULL && *pH!=NULL){
+        free((*pH)->item);
+        free((*pH)->pos);
+        free((*pH)->key);
+        free(*pH);
+        *pH = NULL;
+    }
+}
+
+// newRadixHeap()
+// Returns an empty radix heap for the items 1..n.
+RadixHeap newRadixHeap(int n){
+    RadixHeap R = malloc(sizeof(RadixHeapObj));
+    assert(R!=NULL && "ERROR: newRadixHeap(): out of memory");
+    R->n = n;
+    R->live = 0;
+    R->last = 0;
+    R->key = malloc((n+1)*sizeof(int));
+    assert(R->key!=NULL && "ERROR: newRadixHeap(): out of memory");
+    for(int v = 0; v<=n; v++){
+        R->key[v] = -1;
+    }
+    for(int i = 0; i<BUCKETS; i++){
+        R->b[i].e = NULL;
+        R->b[i].size = 0;
+        R->b[i].capacity = 0;
+    }
+    return R;
+}
+
+// freeRadixHeap()
+// Frees heap memory associated with *pR, sets *pR to NULL.
+void freeRadixHeap(RadixHeap* pR){
+    if(pR!=NULL && *pR!=NULL){
+        for(int i = 0; i<BUCKETS; i++){
+            free((*pR)->b[i].e);
+        }
+        free((*pR)->key);
+        free(*pR);
+        *pR = NULL;
+    }
+}
+
+// Access functions -----------------------------------------------------------
+
+// heapSize()
+// Returns the number of items in H.
+int heapSize(Heap H){
+    if(H==NULL){
+        fprintf(stderr, "Heap ERROR: heapSize(): NULL Heap\n");
+        exit(EXIT_FAILURE);
+    }
+    return H->size;
+}
+
+// inHeap()
+// Returns true if item v is in H.
+bool inHeap(Heap H, int v){
+    if(H==NULL){
+        fprintf(stderr, "Heap ERROR: inHeap(): NULL Heap\n");
+        exit(EXIT_FAILURE);
+    }
+    return v>=1 && v<=H->n && H->pos[v]>=0;
+}
+
+// radixEmpty()
+// Returns true if R has no live entries.
+bool radixEmpty(RadixHeap R){
+    if(R==NULL){
+        fprintf(stderr, "Heap ERROR: radixEmpty(): NULL RadixHeap\n");
+        exit(EXIT_FAILURE);
+    }
+    return R->live==0;
+}
+
+// Manipulation procedures ----------------------------------------------------
+
+// place()
+// Puts item v at index i of H.
+static void place(Heap H, int i, int v){
+    H->item[i] = v;
+    H->pos[v] = i;
+}
+
+// siftUp()
+// Moves the item at index i toward the root until its parent is no larger.
+static void siftUp(Heap H, int i){
+    int v = H->item[i];
+    while(i>0){
+        int p = (i-1)/ARITY;
+        if(H->key[H->item[p]]<=H->key[v]){
+            break;
+        }
+        place(H, i, H->item[p]);
+        i = p;
+    }
+    place(H, i, v);
+}
+
+// siftDown()
+// Moves the item at index i away from the root until no child is smaller.
+// The children of i are next to each other, so one cache line covers them.
+static void siftDown(Heap H, int i){
+    int v = H->item[i];
+    for(;;){
+        int first = ARITY*i+1;
+        if(first>=H->size){
+            break;
+        }
+        int last = (first+ARITY<H->size) ? first+ARITY : H->size;
+        int c = first;
+        for(int j = first+1; j<last; j++){
+            if(H->key[H->item[j]]<H->key[H->item[c]]){
+                c = j;
+            }
+        }
+        if(H->key[H->item[c]]>=H->key[v]){
+            break;
+        }
+        place(H, i, H->item[c]);
+        i = c;
+    }
+    place(H, i, v);
+}
+
+// heapPush()
+// Inserts item v with key k into H, or lowers the key of v to k if v is in H
+// with a larger key. Pre: 1 <= v <= n
+void heapPush(Heap H, int v, int k){
+    if(H==NULL){
+        fprintf(stderr, "Heap ERROR: heapPush(): NULL Heap\n");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1 || v>H->n){
+        fprintf(stderr, "Heap ERROR: heapPush(): item out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    if(H->pos[v]<0){
+        H->key[v] = k;
+        place(H, H->size++, v);
+    }else if(k<H->key[v]){
+        H->key[v] = k;
+    }else{
+        return;
+    }
+    siftUp(H, H->pos[v]);
+}
+
+// heapPop()
+// Removes an item with the smallest key from H, sets *k to that key and
+// returns the item. Pre: heapSize(H) > 0
+int heapPop(Heap H, int* k){
+    if(H==NULL){
+        fprintf(stderr, "Heap ERROR: heapPop(): NULL Heap\n");
+        exit(EXIT_FAILURE);
+    }
+    if(H->size==0){
+        fprintf(stderr, "Heap ERROR: heapPop(): empty Heap\n");
+        exit(EXIT_FAILURE);
+    }
+    int v = H->item[0];
+    *k = H->key[v];
+    H->pos[v] = -1;
+    H->size--;
+    if(H->size>0){
+        place(H, 0, H->item[H->size]);
+        siftDown(H, 0);
+    }
+    return v;
+}
+
+// heapClear()
+// Removes every item from H.
+void heapClear(Heap H){
+    if(H==NULL){
+        fprintf(stderr, "Heap ERROR: heapClear(): NULL Heap\n");
+        exit(EXIT_FAILURE);
+    }
+    for(int i = 0; i<H->size; i++){
+        H->pos[H->item[i]] = -1;
+    }
+    H->size = 0;
+}
+
+// bucketOf()
+// Returns the bucket of key k: 0 if it equals the last key popped, and
+// otherwise one more than the highest bit in which the two differ.
+static int bucketOf(RadixHeap R, int k){
+    unsigned x = (unsigned)k ^ (unsigned)R->last;
+    int i = 0;
+    while(x!=0){
+        x >>= 1;
+        i++;
+    }
+    return i;
+}
+
+// addEntry()
+// Appends the entry (v, k) to bucket i of R.
+static void addEntry(RadixHeap R, int i, int v, int k){
+    bucket* B = &R->b[i];
+    if(B->size==B->capacity){
+        B->capacity = (B->capacity==0) ? 16 : 2*B->capacity;
+        B->e = realloc(B->e, B->capacity*sizeof(entry));
+        assert(B->e!=NULL && "ERROR: radixPush(): out of memory");
+    }
+    B->e[B->size].v = v;
+    B->e[B->size].k = k;
+    B->size++;
+}
+
+// radixPush()
+// Inserts item v with key k into R, or lowers its key to k.
+// Pre: 1 <= v <= n, k >= 0, k is at least the last key popped
+void radixPush(RadixHeap R, int v, int k){
+    if(R==NULL){
+        fprintf(stderr, "Heap ERROR: radixPush(): NULL RadixHeap\n");
+        exit(EXIT_FAILURE);
+    }
+    if(v<1 || v>R->n){
+        fprintf(stderr, "Heap ERROR: radixPush(): item out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    if(k<R->last){
+        fprintf(stderr, "Heap ERROR: radixPush(): key below the last key popped\n");
+        exit(EXIT_FAILURE);
+    }
+    if(R->key[v]<0){
+        R->live++;
+    }else if(k>=R->key[v]){
+        return;
+    }
+    R->key[v] = k;
+    addEntry(R, bucketOf(R, k), v, k);
+}
+
+// radixPop()
+// Removes an item with the smallest key from R, sets *k to that key and
+// returns the item. Pre: !radixEmpty(R)
+int radixPop(RadixHeap R, int* k){
+    if(R==NULL){
+        fprintf(stderr, "Heap ERROR: radixPop(): NULL RadixHeap\n");
+        exit(EXIT_FAILURE);
+    }
+    if(R->live==0){
+        fprintf(stderr, "Heap ERROR: radixPop(): empty RadixHeap\n");
+        exit(EXIT_FAILURE);
+    }
+    for(;;){
+        // stale entries, whose item has since got a smaller key, are dropped
+        bucket* B = &R->b[0];
+        while(B->size>0){
+            entry x = B->e[--B->size];
+            if(R->key[x.v]==x.k){
+                R->key[x.v] = -1;
+                R->live--;
+                *k = x.k;
+                return x.v;
+            }
+        }
+        // refill bucket 0 by redistributing the first nonempty bucket around
+        // its smallest live key
+        int i = 1;
+        while(R->b[i].size==0){
+            i++;
+        }
+        B = &R->b[i];
+        int min = -1;
+        for(int j = 0; j<B->size; j++){
+            entry x = B->e[j];
+            if(R->key[x.v]==x.k && (min<0 || x.k<min)){
+                min = x.k;
+            }
+        }
+        int size = B->size;
+        B->size = 0;
+        if(min<0){
+            continue;
+        }
+        R->last = min;
+        for(int j = 0; j<size; j++){
+            entry x = B->e[j];
+            if(R->key[x.v]==x.k){
+                addEntry(R, bucketOf(R, x.k), x.v, x.k);
+            }
+        }
+    }
+}
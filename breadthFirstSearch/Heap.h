@@ -0,0 +1,82 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Heap.h
+ * Header file for priority queue functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+// Exported Types -------------------------------------------------------------
+
+// An indexed 4-ary min heap of the items 1..n, each with an integer key. It
+// holds an item at most once, so keys can be lowered in place.
+typedef struct HeapObj* Heap;
+
+// A monotone radix heap of the items 1..n. Keys that are popped never
+// decrease, so entries are kept in buckets by the highest bit in which they
+// differ from the last key popped. Lowering a key pushes a second entry and
+// the stale one is skipped when it comes out.
+typedef struct RadixHeapObj* RadixHeap;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newHeap()
+// Returns an empty heap for the items 1..n.
+Heap newHeap(int n);
+
+// freeHeap()
+// Frees heap memory associated with *pH, sets *pH to NULL.
+void freeHeap(Heap* pH);
+
+// newRadixHeap()
+// Returns an empty radix heap for the items 1..n.
+RadixHeap newRadixHeap(int n);
+
+// freeRadixHeap()
+// Frees heap memory associated with *pR, sets *pR to NULL.
+void freeRadixHeap(RadixHeap* pR);
+
+// Access functions -----------------------------------------------------------
+
+// heapSize()
+// Returns the number of items in H.
+int heapSize(Heap H);
+
+// inHeap()
+// Returns true if item v is in H.
+bool inHeap(Heap H, int v);
+
+// radixEmpty()
+// Returns true if R has no live entries.
+bool radixEmpty(RadixHeap R);
+
+// Manipulation procedures ----------------------------------------------------
+
+// heapPush()
+// Inserts item v with key k into H, or lowers the key of v to k if v is in H
+// with a larger key. Pre: 1 <= v <= n
+void heapPush(Heap H, int v, int k);
+
+// heapPop()
+// Removes an item with the smallest key from H, sets *k to that key and
+// returns the item. Pre: heapSize(H) > 0
+int heapPop(Heap H, int* k);
+
+// heapClear()
+// Removes every item from H.
+void heapClear(Heap H);
+
+// radixPush()
+// Inserts item v with key k into R, or lowers its key to k.
+// Pre: 1 <= v <= n, k >= 0, k is at least the last key popped
+void radixPush(RadixHeap R, int v, int k);
+
+// radixPop()
+// Removes an item with the smallest key from R, sets *k to that key and
+// returns the item. Pre: !radixEmpty(R)
+int radixPop(RadixHeap R, int* k);
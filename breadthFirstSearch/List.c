@@ -11,21 +11,34 @@
 #include <string.h>
 #include <stdbool.h>
 #include <assert.h>
+#include <stdatomic.h>
 #include "List.h"
+#include "SkipIndex.h"
 
 
 typedef struct node{
     ListElement data;        
     struct node* next;
     struct node* prev;
+    struct slab* slab;      // NULL if the node was malloc'ed on its own
 } node;
 
+// appendArray() allocates all of its nodes in one slab. Nodes can later be
+// moved to other lists or freed from other threads, so a slab counts its
+// live nodes and is freed when the last one goes.
+typedef struct slab{
+    atomic_int live;
+    node nodes[];
+} slab;
+
 typedef struct ListObj{
     node* front;
     node* back;
     node* cursor;
     int length;
     int position; 
+    SkipIndex index;    // NULL unless setIndexed() turned it on
+    bool stale;         // index must be rebuilt before its next use
 } ListObj;
 
 // Constructors-Destructors ---------------------------------------------------
@@ -38,9 +51,21 @@ node* newNode(ListElement data){
     N->data = data;
     N->next = NULL;
     N->prev = NULL;
+    N->slab = NULL;
     return (N);
 }
 
+// freeNode()
+// Frees node N, or drops it from its slab and frees the slab once it has no
+// live nodes left.
+static void freeNode(node* N){
+    if (N->slab==NULL){
+        free(N);
+    }else if (atomic_fetch_sub(&N->slab->live, 1)==1){
+        free(N->slab);
+    }
+}
+
 // newList()
 // Creates a new empty list.
 List newList(){
@@ -50,6 +75,16 @@ List newList(){
     L->front = L->back = L->cursor = NULL;
     L->length = 0;
     L->position = -1;
+    L->index = NULL;
+    L->stale = false;
+    return (L);
+}
+
+// newListFromArray()
+// Creates a new list holding A[0..n-1] in order. The cursor is undefined.
+List newListFromArray(const ListElement* A, int n){
+    List L = newList();
+    appendArray(L, A, n);
     return (L);
 }
 
@@ -58,11 +93,42 @@ List newList(){
 void freeList(List* pL){
     if (pL!=NULL && *pL!=NULL){
         clear(*pL);
+        freeSkipIndex(&(*pL)->index);
         free(*pL);
         *pL=NULL;
     }
 }
 
+// indexInsert()
+// Records in the index of L that node N was inserted at position pos.
+static void indexInsert(List L, int pos, node* N){
+    if (L->index!=NULL && !L->stale){
+        skipInsert(L->index, pos, N, 1);
+    }
+}
+
+// indexRemove()
+// Records in the index of L that the node at position pos was deleted.
+static void indexRemove(List L, int pos){
+    if (L->index!=NULL && !L->stale){
+        skipRemove(L->index, pos);
+    }
+}
+
+// indexRefresh()
+// Rebuilds a stale index of L. Bulk relinking marks the index stale instead
+// of patching it.
+static void indexRefresh(List L){
+    if (L->index!=NULL && L->stale){
+        skipClear(L->index);
+        int i = 0;
+        for (node* N=L->front; N!=NULL; N=N->next){
+            skipInsert(L->index, i++, N, 1);
+        }
+        L->stale = false;
+    }
+}
+
 // Access functions -----------------------------------------------------------
 
 // length()
@@ -126,6 +192,10 @@ ListElement get(List L){
         fprintf(stderr, "List Error: get(): empty list\n");
         exit(EXIT_FAILURE);
     }
+    if(L->position == -1){
+        fprintf(stderr, "List Error: get(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
     return(L->cursor->data);
 }
 
@@ -153,9 +223,16 @@ bool equals(List A, List B){
 // clear()
 // Resets L to its original empty state.
 void clear(List L){
+    if (length(L)>0 && L->index!=NULL){
+        L->stale = true;
+    }
     while (length(L)>0){
         deleteFront(L);
     }
+    if (L->index!=NULL){
+        skipClear(L->index);
+    }
+    L->stale = false;
 }
 
 // set()
@@ -165,8 +242,8 @@ void set(List L, ListElement x){
         fprintf(stderr, "List Error: set(): List is empty\n");
         exit(EXIT_FAILURE);
     }
-    if (L->position == 0){
-        fprintf(stderr, "List Error: set(): position of cursor is 0\n");
+    if (L->position == -1){
+        fprintf(stderr, "List Error: set(): cursor undefined\n");
         exit(EXIT_FAILURE);
     }else{
         L->cursor->data = x;
@@ -177,7 +254,7 @@ void set(List L, ListElement x){
 // If L is non-empty, places the cursor under the front element, otherwise does
 // nothing.
 void moveFront(List L){
-    if(!(length(L)<0)){
+    if(!(length(L)==0)){
         L->cursor = L->front;
         L->position = 0;
     }
@@ -233,6 +310,7 @@ void moveNext(List L){
 // before front element.
 void prepend(List L, ListElement data){        
     node* N = newNode(data);
+    indexInsert(L, 0, N);
     if (length(L)==0){
         L->front = L->back = N;
     }else{                           
@@ -251,6 +329,7 @@ void prepend(List L, ListElement data){
 // after back element.
 void append(List L, ListElement data){
     node* N = newNode(data);
+    indexInsert(L, length(L), N);
     if (length(L)==0){
         L->front = L->back = N;
     }else{                           
@@ -261,6 +340,45 @@ void append(List L, ListElement data){
     L->length++;
 }
 
+// appendArray()
+// Inserts A[0..n-1] in order after the back element of L. The new nodes are
+// allocated together in one slab, chained and then linked on in one step.
+// The cursor is unchanged. Pre: n>=0
+void appendArray(List L, const ListElement* A, int n){
+    if (L==NULL){
+        fprintf(stderr, "List Error: appendArray(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (n<0){
+        fprintf(stderr, "List Error: appendArray(): negative count\n");
+        exit(EXIT_FAILURE);
+    }
+    if (n==0){
+        return;
+    }
+    slab* S = malloc(sizeof(slab)+(size_t)n*sizeof(node));
+    assert (S!=NULL && "ERROR: appendArray(): out of memory");
+    atomic_init(&S->live, n);
+    for (int i=0; i<n; i++){
+        node* N = &S->nodes[i];
+        N->data = A[i];
+        N->prev = (i>0) ? &S->nodes[i-1] : NULL;
+        N->next = (i<n-1) ? &S->nodes[i+1] : NULL;
+        N->slab = S;
+    }
+    node* first = &S->nodes[0];
+    node* last = &S->nodes[n-1];
+    if (L->length==0){
+        L->front = first;
+    }else{
+        L->back->next = first;
+        first->prev = L->back;
+    }
+    L->back = last;
+    L->length += n;
+    L->stale = (L->index!=NULL);
+}
+
 // insertBefore()
 // Insert new element before cursor. Pre: length()>0, position()>=0
 void insertBefore(List L, ListElement data){
@@ -272,6 +390,7 @@ void insertBefore(List L, ListElement data){
         fprintf(stderr, "List Error: insertBefore(): List is empty\n");
         exit(EXIT_FAILURE); 
     }
+    indexInsert(L, L->position, N);
     if (L->cursor == L->front){
         N->next = L->front;
         L->front->prev = N;
@@ -289,11 +408,6 @@ void insertBefore(List L, ListElement data){
 // insertAfter()
 // Inserts new element after cursor. Pre: length()>0, position()>=0
 void insertAfter(List L, ListElement data){
-    node* N = newNode(data);
-    node* curr = L->cursor;
-    node* next = L->cursor->next;
-    N->prev = curr;
-    curr->next = N;
     if (L->position == -1){
         fprintf(stderr, "List Error: insertAfter(): Cursor position <0\n");
         exit(EXIT_FAILURE);
@@ -301,6 +415,12 @@ void insertAfter(List L, ListElement data){
         fprintf(stderr, "List Error: insertAfter(): List is empty\n");
         exit(EXIT_FAILURE); 
     }
+    node* N = newNode(data);
+    indexInsert(L, L->position+1, N);
+    node* curr = L->cursor;
+    node* next = L->cursor->next;
+    N->prev = curr;
+    curr->next = N;
     if (L->length ==1){
         curr->next = N;
         L->back = N;
@@ -314,6 +434,7 @@ void insertAfter(List L, ListElement data){
     }else{
         curr->next = N;
         N->next = next;
+        next->prev = N;
         L->length++;
     }
     
@@ -331,6 +452,7 @@ void deleteFront(List L){
         fprintf(stderr, "List Error: deleteFront(): Empty List\n");
         exit(EXIT_FAILURE);    
     }
+    indexRemove(L, 0);
     if(L->length == 1){      
         L->front = L->back = NULL;
     } else{
@@ -344,7 +466,7 @@ void deleteFront(List L){
         L->position--;
     }
     L->length--;
-    free(N);
+    freeNode(N);
 }
 
 // deleteBack()
@@ -356,8 +478,9 @@ void deleteBack(List L){
         fprintf(stderr, "List Error: deleteBack(): Empty List\n");
         exit(EXIT_FAILURE);    
     }
+    indexRemove(L, L->length-1);
     if(L->length == 1){      
-        L->back = L->back = NULL;
+        L->front = L->back = NULL;
     } else{
         L->back = L->back->prev;
         L->back->next = NULL;
@@ -367,7 +490,7 @@ void deleteBack(List L){
         L->position = -1;
     }
     L->length--;
-    free(N);
+    freeNode(N);
 }
 
 // delete()
@@ -387,15 +510,188 @@ void delete(List L){
     }else if (N==L->back){
         deleteBack(L);
     }else{
+        indexRemove(L, L->position);
         N->prev->next = N->next;
         N->next->prev = N->prev;
         L->length--;
-        free(N);
+        freeNode(N);
     }
     L->cursor = NULL;
     L->position = -1;
 }
 
+// concatInto()
+// Moves every element of B onto the back of A by relinking, in constant time,
+// leaving B empty. The cursor of A is unchanged and the cursor of B becomes
+// undefined. Pre: A != B
+void concatInto(List A, List B){
+    if (A==NULL || B==NULL){
+        fprintf(stderr, "List Error: concatInto(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (A==B){
+        fprintf(stderr, "List Error: concatInto(): A and B are the same List\n");
+        exit(EXIT_FAILURE);
+    }
+    if (B->length==0){
+        return;
+    }
+    if (A->length==0){
+        A->front = B->front;
+    }else{
+        A->back->next = B->front;
+        B->front->prev = A->back;
+    }
+    A->back = B->back;
+    A->length += B->length;
+    A->stale = (A->index!=NULL);
+    B->front = B->back = B->cursor = NULL;
+    B->length = 0;
+    B->position = -1;
+    if (B->index!=NULL){
+        skipClear(B->index);
+    }
+}
+
+// spliceAt()
+// Moves every element of M into L just before the cursor element of L by
+// relinking, leaving M empty. The cursor of L stays under the same element.
+// Pre: length(L)>0, position(L)>=0, L != M
+void spliceAt(List L, List M){
+    if (L==NULL || M==NULL){
+        fprintf(stderr, "List Error: spliceAt(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (L==M){
+        fprintf(stderr, "List Error: spliceAt(): L and M are the same List\n");
+        exit(EXIT_FAILURE);
+    }
+    if (L->position == -1){
+        fprintf(stderr, "List Error: spliceAt(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
+    if (M->length==0){
+        return;
+    }
+    node* N = L->cursor;
+    M->front->prev = N->prev;
+    M->back->next = N;
+    if (N->prev!=NULL){
+        N->prev->next = M->front;
+    }else{
+        L->front = M->front;
+    }
+    N->prev = M->back;
+    L->length += M->length;
+    L->position += M->length;
+    L->stale = (L->index!=NULL);
+    M->front = M->back = M->cursor = NULL;
+    M->length = 0;
+    M->position = -1;
+    if (M->index!=NULL){
+        skipClear(M->index);
+    }
+}
+
+// splitAt()
+// Same result as split(), but the elements in front of the cursor are
+// detached by relinking instead of being copied one at a time.
+// Pre: length(L)>0, position(L)>=0
+List splitAt(List L){
+    if (length(L)==0){
+        fprintf(stderr, "List Error: splitAt(): List is Empty \n");
+        exit(EXIT_FAILURE);
+    }
+    if (L->position == -1){
+        fprintf(stderr, "List Error: splitAt(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
+    List M = newList();
+    node* N = L->cursor;
+    if (N!=L->front){
+        M->front = L->front;
+        M->back = N->prev;
+        M->back->next = NULL;
+        N->prev = NULL;
+        L->front = N;
+        M->length = L->position;
+        L->length -= L->position;
+        L->position = 0;
+        L->stale = (L->index!=NULL);
+    }
+    return M;
+}
+
+// setIndexed()
+// If on is true, keeps a skip list index over L so that moveTo() and getAt()
+// take O(log n) time, at the cost of O(log n) inserts and deletes. If on is
+// false, drops the index.
+void setIndexed(List L, bool on){
+    if (L==NULL){
+        fprintf(stderr, "List Error: setIndexed(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (on && L->index==NULL){
+        L->index = newSkipIndex();
+        L->stale = true;
+    }else if (!on){
+        freeSkipIndex(&L->index);
+        L->stale = false;
+    }
+}
+
+// nodeAt()
+// Returns the node at index i, from the index if L has one, otherwise by
+// walking from whichever of front, back and cursor is closest.
+static node* nodeAt(List L, int i){
+    if (L->index!=NULL){
+        indexRefresh(L);
+        return skipFind(L->index, i, NULL);
+    }
+    node* N;
+    int from;
+    if (i < L->length-1-i){
+        N = L->front;
+        from = 0;
+    }else{
+        N = L->back;
+        from = L->length-1;
+    }
+    if (L->cursor!=NULL && abs(i-L->position) < abs(i-from)){
+        N = L->cursor;
+        from = L->position;
+    }
+    for (; from<i; from++){
+        N = N->next;
+    }
+    for (; from>i; from--){
+        N = N->prev;
+    }
+    return N;
+}
+
+// moveTo()
+// Places the cursor under the element at index i. Pre: 0 <= i < length()
+void moveTo(List L, int i){
+    if (i<0 || i>=length(L)){
+        fprintf(stderr, "List Error: moveTo(): index out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    L->cursor = nodeAt(L, i);
+    L->position = i;
+}
+
+// getAt()
+// Returns the element at index i. The cursor is not altered.
+// Pre: 0 <= i < length()
+ListElement getAt(List L, int i){
+    if (i<0 || i>=length(L)){
+        fprintf(stderr, "List Error: getAt(): index out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    return nodeAt(L, i)->data;
+}
+
 // Other operations -----------------------------------------------------------
 
 // printList()
@@ -418,6 +714,22 @@ void printList(FILE* out, List L){
     fprintf(out,")\n");
 }
 
+// toArray()
+// Copies the elements of L, front to back, into out[0..length(L)-1] and
+// returns length(L). The cursor is not altered.
+// Pre: out has room for length(L) elements
+int toArray(List L, ListElement* out){
+    if (L==NULL){
+        fprintf(stderr, "List Error: toArray(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    int i = 0;
+    for (node* N=L->front; N!=NULL; N=N->next){
+        out[i++] = N->data;
+    }
+    return i;
+}
+
 // copyList()
 // Returns a new List representing the same integer sequence as L. The cursor
 // in the new list is undefined, regardless of the state of the cursor in L. The
@@ -425,7 +737,7 @@ void printList(FILE* out, List L){
 List copyList(List L){
     List M = newList();
     for(node* N=L->front; N!=NULL;N=N->next){
-        append(M,L->front->data);
+        append(M,N->data);
     }
     return M;
 }
@@ -457,8 +769,8 @@ List split(List L){
         fprintf(stderr, "List Error: split(): List is Empty \n");
         exit(EXIT_FAILURE);  
     }
-    if (L->position == 0){
-        fprintf(stderr, "List Error: split(): position of cursor is 0\n");
+    if (L->position == -1){
+        fprintf(stderr, "List Error: split(): cursor undefined\n");
         exit(EXIT_FAILURE);
     }else{
         int i = 0;
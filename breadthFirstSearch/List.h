@@ -24,6 +24,10 @@ typedef struct ListObj*List;
 // Creates a new empty list.
 List newList();
 
+// newListFromArray()
+// Creates a new list holding A[0..n-1] in order. The cursor is undefined.
+List newListFromArray(const ListElement* A, int n);
+
 // freeList()
 // Frees heap memory associated with *pL, sets *pL to NULL.
 void freeList(List* pL);
@@ -99,6 +103,11 @@ void prepend(List L, ListElement data);
 // after back element.
 void append(List L, ListElement data);
 
+// appendArray()
+// Inserts A[0..n-1] in order after the back element of L. The cursor is
+// unchanged. Pre: n>=0
+void appendArray(List L, const ListElement* A, int n);
+
 // insertBefore()
 // Insert new element before cursor. Pre: length()>0, position()>=0
 void insertBefore(List L, ListElement data);
@@ -119,6 +128,39 @@ void deleteBack(List L);
 // Deletes cursor element, making cursor undefined. Pre: length()>0, position()>=0
 void delete(List L);
 
+// concatInto()
+// Moves every element of B onto the back of A by relinking, in constant time,
+// leaving B empty. The cursor of A is unchanged and the cursor of B becomes
+// undefined. Pre: A != B
+void concatInto(List A, List B);
+
+// spliceAt()
+// Moves every element of M into L just before the cursor element of L by
+// relinking, leaving M empty. The cursor of L stays under the same element.
+// Pre: length(L)>0, position(L)>=0, L != M
+void spliceAt(List L, List M);
+
+// splitAt()
+// Same result as split(), but the elements in front of the cursor are
+// detached by relinking instead of being copied one at a time.
+// Pre: length(L)>0, position(L)>=0
+List splitAt(List L);
+
+// setIndexed()
+// If on is true, keeps a skip list index over L so that moveTo() and getAt()
+// take O(log n) time, at the cost of O(log n) inserts and deletes. If on is
+// false, drops the index.
+void setIndexed(List L, bool on);
+
+// moveTo()
+// Places the cursor under the element at index i. Pre: 0 <= i < length()
+void moveTo(List L, int i);
+
+// getAt()
+// Returns the element at index i. The cursor is not altered.
+// Pre: 0 <= i < length()
+ListElement getAt(List L, int i);
+
 // Other operations -----------------------------------------------------------
 
 // printList()
@@ -127,6 +169,12 @@ void delete(List L);
 // pointed to by out.
 void printList(FILE* out, List L);
 
+// toArray()
+// Copies the elements of L, front to back, into out[0..length(L)-1] and
+// returns length(L). The cursor is not altered.
+// Pre: out has room for length(L) elements
+int toArray(List L, ListElement* out);
+
 // copyList()
 // Returns a new List representing the same integer sequence as L. The cursor
 // in the new list is undefined, regardless of the state of the cursor in L. The
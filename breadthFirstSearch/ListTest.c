@@ -0,0 +1,249 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * ListTest.c
+ * Test of list functions
+ ***/
+
+#include <string.h>
+#include "List.h"
+
+static int failures = 0;
+
+// check()
+// Prints the result of one test and counts the failures.
+static void check(bool ok, const char* name){
+    fprintf(stdout, "%s: %s\n", name, ok ? "passed" : "FAILED");
+    if (!ok){
+        failures++;
+    }
+}
+
+// matches()
+// Returns true if L holds exactly the n values in a, walking with the cursor.
+static bool matches(List L, const int* a, int n){
+    if (length(L)!=n){
+        return false;
+    }
+    int i = 0;
+    for (moveFront(L); position(L)>=0; moveNext(L)){
+        if (position(L)!=i || get(L)!=a[i]){
+            return false;
+        }
+        i++;
+    }
+    return i==n;
+}
+
+int main(void){
+    List A = newList();
+    List B = newList();
+    int model[1000];
+    int n = 0;
+
+    moveFront(A);
+    check(position(A)==-1, "moveFront on empty list");
+
+    for (int i = 1; i<=100; i++){
+        append(A, i);
+        prepend(B, i);
+    }
+    check(length(A)==100 && front(A)==1 && back(A)==100, "append");
+    check(length(B)==100 && front(B)==100 && back(B)==1, "prepend");
+    check(!equals(A, B), "equals on different lists");
+
+    moveBack(A);
+    for (int i = 0; i<40; i++){
+        movePrev(A);
+    }
+    check(position(A)==59 && get(A)==60, "movePrev");
+    insertBefore(A, -1);
+    insertAfter(A, -2);
+    check(position(A)==60 && get(A)==60 && length(A)==102, "insertBefore and insertAfter");
+    movePrev(A);
+    check(get(A)==-1, "element inserted before");
+    moveNext(A);
+    moveNext(A);
+    check(get(A)==-2, "element inserted after");
+    delete(A);
+    check(position(A)==-1 && length(A)==101, "delete");
+    moveFront(A);
+    while (get(A)!=-1){
+        moveNext(A);
+    }
+    delete(A);
+
+    moveFront(B);
+    moveNext(B);
+    deleteFront(B);
+    check(position(B)==0 && get(B)==99, "deleteFront before cursor");
+    deleteBack(B);
+    check(back(B)==2 && position(B)==0, "deleteBack");
+    set(B, 0);
+    check(front(B)==0, "set at the front");
+
+    List C = copyList(A);
+    check(equals(A, C) && position(C)==-1, "copyList");
+    List D = join(A, C);
+    check(length(D)==200 && front(D)==1 && back(D)==100, "join");
+    moveFront(D);
+    for (int i = 0; i<150; i++){
+        moveNext(D);
+    }
+    List E = split(D);
+    check(length(E)==150 && length(D)==50 && position(D)==0 && get(D)==51, "split");
+    moveFront(D);
+    List F = split(D);
+    check(length(F)==0 && length(D)==50, "split at the front");
+
+    List G = newList();
+    List H = newList();
+    setIndexed(G, true);
+    for (int i = 1; i<=60; i++){
+        append(G, i);
+        append(H, 100+i);
+    }
+    moveFront(G);
+    moveNext(G);
+    concatInto(G, H);
+    check(length(G)==120 && length(H)==0 && position(H)==-1 && back(G)==160
+          && position(G)==1 && get(G)==2, "concatInto");
+    for (int i = 1; i<=5; i++){
+        append(H, -i);
+    }
+    moveFront(G);
+    for (int i = 0; i<37; i++){
+        moveNext(G);
+    }
+    spliceAt(G, H);
+    check(length(G)==125 && length(H)==0 && position(G)==42 && get(G)==38, "spliceAt");
+    movePrev(G);
+    check(get(G)==-5, "element spliced before the cursor");
+    check(getAt(G, 0)==1 && getAt(G, 37)==-1 && getAt(G, 124)==160, "getAt after spliceAt");
+    moveNext(G);
+    List I = splitAt(G);
+    check(length(I)==42 && back(I)==-5 && length(G)==83 && position(G)==0
+          && front(G)==38, "splitAt");
+    concatInto(I, G);
+    concatInto(H, I);
+    check(length(H)==125 && front(H)==1 && back(H)==160, "concatInto an empty List");
+    freeList(&G);
+    freeList(&H);
+    freeList(&I);
+
+    // array import and export
+    int in[300];
+    int out[300];
+    for (int i = 0; i<300; i++){
+        in[i] = 3*i;
+    }
+    List J = newListFromArray(in, 100);
+    setIndexed(J, true);
+    moveFront(J);
+    moveNext(J);
+    appendArray(J, in+100, 200);
+    check(matches(J, in, 300), "newListFromArray and appendArray");
+    check(getAt(J, 250)==750, "getAt after appendArray");
+    check(toArray(J, out)==300 && memcmp(in, out, sizeof(in))==0, "toArray");
+    appendArray(J, in, 0);
+    check(length(J)==300, "appendArray of nothing");
+    freeList(&J);
+
+    // random edits checked against an array model
+    clear(A);
+    check(length(A)==0 && position(A)==-1, "clear");
+    unsigned seed = 1;
+    int cur = -1;
+    for (int step = 0; step<20000; step++){
+        if (step==10000){
+            setIndexed(A, true);
+        }
+        seed = seed*1103515245u + 12345u;
+        int op = (seed>>16) % 8;
+        int x = (int)(seed % 1000);
+        if ((op==0 && n<1000) || n==0){
+            append(A, x);
+            model[n++] = x;
+        }else if (op==1 && n<1000){
+            prepend(A, x);
+            for (int i = n; i>0; i--){
+                model[i] = model[i-1];
+            }
+            model[0] = x;
+            n++;
+            if (cur>=0){
+                cur++;
+            }
+        }else if (op==2 && cur>=0 && n<1000){
+            insertBefore(A, x);
+            for (int i = n; i>cur; i--){
+                model[i] = model[i-1];
+            }
+            model[cur++] = x;
+            n++;
+        }else if (op==3 && cur>=0 && n<1000){
+            insertAfter(A, x);
+            for (int i = n; i>cur+1; i--){
+                model[i] = model[i-1];
+            }
+            model[cur+1] = x;
+            n++;
+        }else if (op==4 && cur>=0){
+            delete(A);
+            for (int i = cur; i<n-1; i++){
+                model[i] = model[i+1];
+            }
+            n--;
+            cur = -1;
+        }else if (op==5){
+            deleteFront(A);
+            for (int i = 0; i<n-1; i++){
+                model[i] = model[i+1];
+            }
+            n--;
+            cur = (cur>0) ? cur-1 : -1;
+        }else if (op==6){
+            deleteBack(A);
+            n--;
+            if (cur==n){
+                cur = -1;
+            }
+        }else if (x%4==0){
+            moveTo(A, x%n);
+            cur = x%n;
+        }else{
+            if (x%3==0){
+                moveFront(A);
+            }else if (x%3==1){
+                moveBack(A);
+            }
+            cur = position(A);
+            for (int i = 0; i<(x%5); i++){
+                if (x%2){
+                    moveNext(A);
+                }else{
+                    movePrev(A);
+                }
+            }
+            cur = position(A);
+        }
+        if (position(A)!=cur || length(A)!=n || (cur>=0 && get(A)!=model[cur])
+            || (n>0 && getAt(A, x%n)!=model[x%n])){
+            break;
+        }
+    }
+    int saved = position(A);
+    check(saved==cur && matches(A, model, n), "random edits with moveTo and getAt");
+
+    printList(stdout, D);
+
+    freeList(&A);
+    freeList(&B);
+    freeList(&C);
+    freeList(&D);
+    freeList(&E);
+    freeList(&F);
+    fprintf(stdout, "%d failures\n", failures);
+    return (failures==0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
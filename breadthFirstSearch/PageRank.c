@@ -0,0 +1,210 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * PageRank.c
+ * Definition of PageRank.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Parallel.h"
+#include "PageRank.h"
+
+typedef struct rankArgs{
+    CSR out;                // arcs of G
+    CSR in;                 // arcs of G reversed
+    double damping;
+    double* rank;
+    double* next;
+    double* share;          // rank[u] split over the out-arcs of u
+    double* dangling;       // per-thread rank held by vertices without out-arcs
+    double* change;         // per-thread L1 change of the ranks
+    double base;            // rank every vertex gets from teleports and dangling vertices
+} rankArgs;
+
+// shareTask()
+// Pass 1: every thread splits the ranks of its block of vertices over their
+// out-arcs and totals the rank of the dangling ones.
+static void shareTask(int id, int threads, void* p){
+    rankArgs* A = p;
+    int lo = chunkStart(1, A->out->n+1, id, threads);
+    int hi = chunkStart(1, A->out->n+1, id+1, threads);
+    double dangling = 0;
+    for(int u = lo; u<hi; u++){
+        int d = A->out->offset[u+1]-A->out->offset[u];
+        if(d==0){
+            dangling += A->rank[u];
+            A->share[u] = 0;
+        }else{
+            A->share[u] = A->rank[u]/d;
+        }
+    }
+    A->dangling[id] = dangling;
+}
+
+// pullTask()
+// Pass 2: every thread sums the shares of the in-neighbors of its block of
+// vertices into their next ranks and totals how far they moved.
+static void pullTask(int id, int threads, void* p){
+    rankArgs* A = p;
+    CSR in = A->in;
+    int lo = chunkStart(1, in->n+1, id, threads);
+    int hi = chunkStart(1, in->n+1, id+1, threads);
+    double change = 0;
+    for(int v = lo; v<hi; v++){
+        double sum = 0;
+        for(int i = in->offset[v]; i<in->offset[v+1]; i++){
+            sum += A->share[in->nbr[i]];
+        }
+        A->next[v] = A->base+A->damping*sum;
+        double diff = A->next[v]-A->rank[v];
+        change += (diff<0) ? -diff : diff;
+    }
+    A->change[id] = change;
+}
+
+// pageRank()
+// Sets rank[u] for 1 <= u <= getOrder(G) to the PageRank of u with the given
+// damping factor, the ranks summing to 1. Vertices without out-arcs spread
+// their rank over every vertex. Each iteration pulls the rank of every vertex
+// from its in-neighbors in a transposed CSR of G, with the vertices shared by
+// threads worker threads, and iterations stop once the ranks change by less
+// than tol in total (L1) or after maxIter of them. Returns the number of
+// iterations run.
+// Pre: 0 <= damping < 1, rank has room for getOrder(G)+1 doubles
+int pageRank(Graph G, double* rank, double damping, double tol, int maxIter, int threads){
+    if (G==NULL || rank==NULL){
+        fprintf(stderr, "PageRank ERROR: pageRank(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if(damping<0 || damping>=1){
+        fprintf(stderr, "PageRank ERROR: pageRank(): damping outside [0, 1)\n");
+        exit(EXIT_FAILURE);
+    }
+    if(threads<1){
+        threads = 1;
+    }
+    rankArgs A;
+    A.out = newCSRFromGraph(G);
+    A.in = transposeCSR(A.out, threads);
+    int n = A.out->n;
+    A.damping = damping;
+    A.rank = malloc((n+1)*sizeof(double));
+    A.next = malloc((n+1)*sizeof(double));
+    A.share = malloc((n+1)*sizeof(double));
+    A.dangling = malloc(threads*sizeof(double));
+    A.change = malloc(threads*sizeof(double));
+    assert(A.rank!=NULL && A.next!=NULL && A.share!=NULL && A.dangling!=NULL
+           && A.change!=NULL && "ERROR: pageRank(): out of memory");
+    for(int u = 1; u<=n; u++){
+        A.rank[u] = 1.0/n;
+    }
+
+    int iter = 0;
+    while(iter<maxIter){
+        iter++;
+        parallelRun(threads, shareTask, &A);
+        double dangling = 0;
+        for(int t = 0; t<threads; t++){
+            dangling += A.dangling[t];
+        }
+        A.base = (1-damping+damping*dangling)/n;
+        parallelRun(threads, pullTask, &A);
+        double change = 0;
+        for(int t = 0; t<threads; t++){
+            change += A.change[t];
+        }
+        double* t = A.rank;
+        A.rank = A.next;
+        A.next = t;
+        if(change<tol){
+            break;
+        }
+    }
+    for(int u = 1; u<=n; u++){
+        rank[u] = A.rank[u];
+    }
+
+    free(A.rank);
+    free(A.next);
+    free(A.share);
+    free(A.dangling);
+    free(A.change);
+    freeCSR(&A.in);
+    freeCSR(&A.out);
+    return iter;
+}
+
+// personalizedPageRank()
+// Sets rank[u] for 1 <= u <= getOrder(G) to an estimate of the PageRank of u
+// personalized to s, that is with every teleport going back to s. Uses the
+// forward push method: residual mass starts at s and is pushed along out-arcs
+// until every vertex u holds less than eps*max(1, outdegree(u)) of it, so the
+// search stays near s. Ranks only ever fall short, and in total by the mass
+// left over, which is less than eps*(n+m) for n vertices and m arcs.
+// Pre: 1 <= s <= getOrder(G), 0 <= damping < 1, eps > 0, rank has room for
+// getOrder(G)+1 doubles
+void personalizedPageRank(Graph G, int s, double* rank, double damping, double eps){
+    if (G==NULL || rank==NULL){
+        fprintf(stderr, "PageRank ERROR: personalizedPageRank(): NULL reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if(s<1 || s>getOrder(G)){
+        fprintf(stderr, "PageRank ERROR: personalizedPageRank(): invalid source vertex\n");
+        exit(EXIT_FAILURE);
+    }
+    if(damping<0 || damping>=1 || eps<=0){
+        fprintf(stderr, "PageRank ERROR: personalizedPageRank(): invalid damping or eps\n");
+        exit(EXIT_FAILURE);
+    }
+    CSR C = newCSRFromGraph(G);
+    int n = C->n;
+    double* residual = calloc(n+1, sizeof(double));
+    int* queue = malloc(n*sizeof(int));     // ring of the vertices over the threshold
+    bool* queued = calloc(n+1, sizeof(bool));
+    assert(residual!=NULL && queue!=NULL && queued!=NULL
+           && "ERROR: personalizedPageRank(): out of memory");
+    for(int u = 1; u<=n; u++){
+        rank[u] = 0;
+    }
+
+    int head = 0, size = 0;
+    residual[s] = 1;
+    queue[0] = s;
+    queued[s] = true;
+    size = 1;
+    while(size>0){
+        int u = queue[head];
+        head = (head+1)%n;
+        size--;
+        queued[u] = false;
+        double r = residual[u];
+        residual[u] = 0;
+        rank[u] += (1-damping)*r;
+        int d = C->offset[u+1]-C->offset[u];
+        // a dangling vertex teleports its mass back to s
+        int lo = (d==0) ? 0 : C->offset[u];
+        int hi = (d==0) ? 1 : C->offset[u+1];
+        double push = damping*r/(hi-lo);
+        for(int i = lo; i<hi; i++){
+            int v = (d==0) ? s : C->nbr[i];
+            residual[v] += push;
+            int dv = C->offset[v+1]-C->offset[v];
+            if(!queued[v] && residual[v]>=eps*(dv>0 ? dv : 1)){
+                queue[(head+size)%n] = v;
+                queued[v] = true;
+                size++;
+            }
+        }
+    }
+
+    free(residual);
+    free(queue);
+    free(queued);
+    freeCSR(&C);
+}
@@ -0,0 +1,35 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * PageRank.h
+ * Header file for PageRank functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// pageRank()
+// Sets rank[u] for 1 <= u <= getOrder(G) to the PageRank of u with the given
+// damping factor, the ranks summing to 1. Vertices without out-arcs spread
+// their rank over every vertex. Each iteration pulls the rank of every vertex
+// from its in-neighbors in a transposed CSR of G, with the vertices shared by
+// threads worker threads, and iterations stop once the ranks change by less
+// than tol in total (L1) or after maxIter of them. Returns the number of
+// iterations run.
+// Pre: 0 <= damping < 1, rank has room for getOrder(G)+1 doubles
+int pageRank(Graph G, double* rank, double damping, double tol, int maxIter, int threads);
+
+// personalizedPageRank()
+// Sets rank[u] for 1 <= u <= getOrder(G) to an estimate of the PageRank of u
+// personalized to s, that is with every teleport going back to s. Uses the
+// forward push method: residual mass starts at s and is pushed along out-arcs
+// until every vertex u holds less than eps*max(1, outdegree(u)) of it, so the
+// search stays near s. Ranks only ever fall short, and in total by the mass
+// left over, which is less than eps*(n+m) for n vertices and m arcs.
+// Pre: 1 <= s <= getOrder(G), 0 <= damping < 1, eps > 0, rank has room for
+// getOrder(G)+1 doubles
+void personalizedPageRank(Graph G, int s, double* rank, double damping, double eps);
@@ -0,0 +1,75 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Parallel.c
+ * Definition of Parallel.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include <pthread.h>
+#include "Parallel.h"
+
+typedef struct worker{
+    int id;
+    int threads;
+    void (*task)(int, int, void*);
+    void* arg;
+} worker;
+
+// runWorker()
+// pthread entry point, unpacks a worker and runs its task.
+static void* runWorker(void* p){
+    worker* W = p;
+    W->task(W->id, W->threads, W->arg);
+    return NULL;
+}
+
+// parallelRun()
+// Runs task(id, threads, arg) on threads worker threads with id = 0..threads-1
+// and returns once every one of them has finished. If threads <= 1 the task is
+// run once on the calling thread.
+void parallelRun(int threads, void (*task)(int id, int threads, void* arg), void* arg){
+    if (task == NULL){
+        fprintf(stderr, "Parallel ERROR: parallelRun(): NULL task\n");
+        exit(EXIT_FAILURE);
+    }
+    if (threads <= 1){
+        task(0, 1, arg);
+        return;
+    }
+    pthread_t* tid = malloc(threads*sizeof(pthread_t));
+    worker* W = malloc(threads*sizeof(worker));
+    assert(tid!=NULL && W!=NULL && "ERROR: parallelRun(): out of memory");
+
+    // worker 0 is the calling thread
+    for (int i = 0; i < threads; i++){
+        W[i].id = i;
+        W[i].threads = threads;
+        W[i].task = task;
+        W[i].arg = arg;
+    }
+    for (int i = 1; i < threads; i++){
+        if (pthread_create(&tid[i], NULL, runWorker, &W[i]) != 0){
+            fprintf(stderr, "Parallel ERROR: parallelRun(): could not create thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    runWorker(&W[0]);
+    for (int i = 1; i < threads; i++){
+        pthread_join(tid[i], NULL);
+    }
+    free(tid);
+    free(W);
+}
+
+// chunkStart()
+// Returns the first index of the id-th of threads nearly equal chunks of the
+// range [lo, hi). The chunk ends at chunkStart(lo, hi, id+1, threads).
+int chunkStart(int lo, int hi, int id, int threads){
+    long span = (long)hi - lo;
+    return lo + (int)(span*id/threads);
+}
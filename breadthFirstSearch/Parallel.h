@@ -0,0 +1,23 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Parallel.h
+ * Header file for thread helper functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+// parallelRun()
+// Runs task(id, threads, arg) on threads worker threads with id = 0..threads-1
+// and returns once every one of them has finished. If threads <= 1 the task is
+// run once on the calling thread.
+void parallelRun(int threads, void (*task)(int id, int threads, void* arg), void* arg);
+
+// chunkStart()
+// Returns the first index of the id-th of threads nearly equal chunks of the
+// range [lo, hi). The chunk ends at chunkStart(lo, hi, id+1, threads).
+int chunkStart(int lo, int hi, int id, int threads);
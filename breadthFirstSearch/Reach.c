@@ -0,0 +1,240 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Reach.c
+ * Definition of Reach.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <assert.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Components.h"
+#include "Reach.h"
+
+typedef struct ReachObj{
+    int n;              // vertices of G
+    int k;              // labels per component
+    int* comp;          // comp[u] is the component of vertex u
+    CSR dag;            // condensation, arcs only go to higher components
+    int* level;         // longest path from a source component
+    int* low;           // label i of component c is [low[c*k+i], post[c*k+i]]
+    int* post;
+    int* mark;          // search stamps for the fallback search
+    int* stack;
+    int stamp;
+} ReachObj;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// nextRandom()
+// Returns the next value of a xorshift generator, so labels are repeatable.
+static unsigned nextRandom(unsigned* state){
+    unsigned x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// labelDAG()
+// Fills in label i of every component with one post-order traversal that
+// visits roots and children starting at random positions.
+static void labelDAG(Reach R, int i, unsigned* seed, int* next, int* first){
+    CSR D = R->dag;
+    int nc = D->n, k = R->k;
+    int* call = R->stack;
+    int rank = 0;
+    for(int c = 1; c<=nc; c++){
+        next[c] = -1;
+    }
+    int shift = nextRandom(seed) % nc;
+    for(int j = 0; j<nc; j++){
+        int r = 1 + (j+shift) % nc;
+        if(next[r]>=0){
+            continue;
+        }
+        int depth = 0;
+        int d = D->offset[r+1]-D->offset[r];
+        first[r] = (d>0) ? (int)(nextRandom(seed) % d) : 0;
+        next[r] = 0;
+        R->low[r*k+i] = nc+1;
+        call[depth++] = r;
+        while(depth>0){
+            int x = call[depth-1];
+            int dx = D->offset[x+1]-D->offset[x];
+            if(next[x]<dx){
+                int y = D->nbr[D->offset[x] + (first[x]+next[x]) % dx];
+                next[x]++;
+                if(next[y]<0){
+                    int dy = D->offset[y+1]-D->offset[y];
+                    first[y] = (dy>0) ? (int)(nextRandom(seed) % dy) : 0;
+                    next[y] = 0;
+                    R->low[y*k+i] = nc+1;
+                    call[depth++] = y;
+                }else if(R->low[y*k+i]<R->low[x*k+i]){
+                    R->low[x*k+i] = R->low[y*k+i];
+                }
+            }else{
+                depth--;
+                R->post[x*k+i] = ++rank;
+                if(rank<R->low[x*k+i]){
+                    R->low[x*k+i] = rank;
+                }
+                if(depth>0){
+                    int p = call[depth-1];
+                    if(R->low[x*k+i]<R->low[p*k+i]){
+                        R->low[p*k+i] = R->low[x*k+i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// newReach()
+// Returns a reachability index of G. G is condensed to its component DAG and
+// every component gets k interval labels from randomized post-order
+// traversals (GRAIL). Later changes to G are not seen by the index.
+// Pre: k >= 1
+Reach newReach(Graph G, int k){
+    if (G==NULL){
+        fprintf(stderr, "Reach ERROR: newReach(): NULL Graph reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (k<1){
+        fprintf(stderr, "Reach ERROR: newReach(): k must be at least 1\n");
+        exit(EXIT_FAILURE);
+    }
+    Reach R = malloc(sizeof(ReachObj));
+    assert(R!=NULL && "ERROR: newReach(): NULL Reach");
+    R->n = getOrder(G);
+    R->k = k;
+    R->comp = malloc((R->n+1)*sizeof(int));
+    assert(R->comp!=NULL && "ERROR: newReach(): out of memory");
+    int nc = stronglyConnectedComponents(G, R->comp);
+    Graph D = condensation(G, R->comp, nc);
+    R->dag = newCSRFromGraph(D);
+    freeGraph(&D);
+
+    R->level = calloc(nc+1, sizeof(int));
+    R->low = malloc((long)(nc+1)*k*sizeof(int));
+    R->post = malloc((long)(nc+1)*k*sizeof(int));
+    R->mark = calloc(nc+1, sizeof(int));
+    R->stack = malloc((nc+1)*sizeof(int));
+    int* next = malloc((nc+1)*sizeof(int));
+    int* first = malloc((nc+1)*sizeof(int));
+    assert(R->level!=NULL && R->low!=NULL && R->post!=NULL && R->mark!=NULL
+           && R->stack!=NULL && next!=NULL && first!=NULL && "ERROR: newReach(): out of memory");
+    R->stamp = 0;
+
+    // components are in topological order, so one forward pass sets levels
+    for(int c = 1; c<=nc; c++){
+        for(int j = R->dag->offset[c]; j<R->dag->offset[c+1]; j++){
+            int d = R->dag->nbr[j];
+            if(R->level[c]+1>R->level[d]){
+                R->level[d] = R->level[c]+1;
+            }
+        }
+    }
+    unsigned seed = 2463534242u;
+    if(nc>0){
+        for(int i = 0; i<k; i++){
+            labelDAG(R, i, &seed, next, first);
+        }
+    }
+    free(next);
+    free(first);
+    return R;
+}
+
+// freeReach()
+// Frees heap memory associated with *pR, sets *pR to NULL.
+void freeReach(Reach* pR){
+    if (pR!=NULL && *pR!=NULL){
+        Reach R = *pR;
+        free(R->comp);
+        freeCSR(&R->dag);
+        free(R->level);
+        free(R->low);
+        free(R->post);
+        free(R->mark);
+        free(R->stack);
+        free(R);
+        *pR = NULL;
+    }
+}
+
+// Access functions -----------------------------------------------------------
+
+// mayReach()
+// Returns false if the levels or some label of component c prove that it
+// cannot reach component d.
+static bool mayReach(Reach R, int c, int d){
+    if(c>d || R->level[c]>=R->level[d]){
+        return false;
+    }
+    int k = R->k;
+    for(int i = 0; i<k; i++){
+        if(R->low[c*k+i]>R->low[d*k+i] || R->post[d*k+i]>R->post[c*k+i]){
+            return false;
+        }
+    }
+    return true;
+}
+
+// canReach()
+// Returns true if there is a path from u to v in G. Most negative answers
+// come from comparing topological levels and labels; otherwise a depth first
+// search of the DAG pruned by the labels decides. Not safe to call on the same
+// index from several threads at once.
+// Pre: 1 <= u <= n, 1 <= v <= n, n the order of G
+bool canReach(Reach R, int u, int v){
+    if (R==NULL){
+        fprintf(stderr, "Reach ERROR: canReach(): NULL Reach reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (u<1 || u>R->n || v<1 || v>R->n){
+        fprintf(stderr, "Reach ERROR: canReach(): vertex out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    int c = R->comp[u];
+    int d = R->comp[v];
+    if(c==d){
+        return true;
+    }
+    if(!mayReach(R, c, d)){
+        return false;
+    }
+
+    if(R->stamp==INT_MAX){
+        for(int x = 0; x<=R->dag->n; x++){
+            R->mark[x] = 0;
+        }
+        R->stamp = 0;
+    }
+    R->stamp++;
+    CSR D = R->dag;
+    int top = 0;
+    R->stack[top++] = c;
+    R->mark[c] = R->stamp;
+    while(top>0){
+        int x = R->stack[--top];
+        for(int j = D->offset[x]; j<D->offset[x+1]; j++){
+            int y = D->nbr[j];
+            if(y==d){
+                return true;
+            }
+            if(R->mark[y]!=R->stamp && mayReach(R, y, d)){
+                R->mark[y] = R->stamp;
+                R->stack[top++] = y;
+            }
+        }
+    }
+    return false;
+}
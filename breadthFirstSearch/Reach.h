@@ -0,0 +1,40 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * Reach.h
+ * Header file for reachability index functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "Graph.h"
+
+// Exported Types -------------------------------------------------------------
+
+typedef struct ReachObj* Reach;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newReach()
+// Returns a reachability index of G. G is condensed to its component DAG and
+// every component gets k interval labels from randomized post-order
+// traversals (GRAIL). Later changes to G are not seen by the index.
+// Pre: k >= 1
+Reach newReach(Graph G, int k);
+
+// freeReach()
+// Frees heap memory associated with *pR, sets *pR to NULL.
+void freeReach(Reach* pR);
+
+// Access functions -----------------------------------------------------------
+
+// canReach()
+// Returns true if there is a path from u to v in G. Most negative answers
+// come from comparing topological levels and labels; otherwise a depth first
+// search of the DAG pruned by the labels decides. Not safe to call on the same
+// index from several threads at once.
+// Pre: 1 <= u <= n, 1 <= v <= n, n the order of G
+bool canReach(Reach R, int u, int v);
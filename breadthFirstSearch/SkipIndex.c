@@ -0,0 +1,220 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * SkipIndex.c
+ * Definition of SkipIndex.h functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "SkipIndex.h"
+
+#define MAX_LEVEL 16
+
+typedef struct link{
+    struct snode* next;
+    int width;          // positions from the start of this item to next
+} link;
+
+typedef struct snode{
+    void* item;
+    int size;
+    int level;
+    link forward[];
+} snode;
+
+typedef struct SkipIndexObj{
+    snode* head;        // size 0 sentinel with MAX_LEVEL links
+    int level;          // levels in use
+    unsigned seed;
+} SkipIndexObj;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newSnode()
+// Returns a pointer to a new node with level links.
+static snode* newSnode(void* item, int size, int level){
+    snode* N = malloc(sizeof(snode) + level*sizeof(link));
+    assert (N!=NULL);
+    N->item = item;
+    N->size = size;
+    N->level = level;
+    for (int i = 0; i<level; i++){
+        N->forward[i].next = NULL;
+        N->forward[i].width = 0;
+    }
+    return N;
+}
+
+// newSkipIndex()
+// Creates a new empty index.
+SkipIndex newSkipIndex(void){
+    SkipIndex S = malloc(sizeof(SkipIndexObj));
+    assert (S!=NULL);
+    S->head = newSnode(NULL, 0, MAX_LEVEL);
+    S->level = 1;
+    S->seed = 12345u;
+    return S;
+}
+
+// freeSkipIndex()
+// Frees heap memory associated with *pS, sets *pS to NULL.
+void freeSkipIndex(SkipIndex* pS){
+    if (pS!=NULL && *pS!=NULL){
+        skipClear(*pS);
+        free((*pS)->head);
+        free(*pS);
+        *pS = NULL;
+    }
+}
+
+// Access functions -----------------------------------------------------------
+
+// skipFind()
+// Returns the item covering element position pos and sets *offset to the
+// index of pos inside that item. Pre: 0 <= pos < total size
+void* skipFind(SkipIndex S, int pos, int* offset){
+    snode* x = S->head;
+    int start = 0;
+    for (int i = S->level-1; i>=0; i--){
+        while (x->forward[i].next!=NULL && start + x->forward[i].width <= pos){
+            start += x->forward[i].width;
+            x = x->forward[i].next;
+        }
+    }
+    if (x==S->head){
+        fprintf(stderr, "SkipIndex Error: skipFind(): position out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    if (offset!=NULL){
+        *offset = pos - start;
+    }
+    return x->item;
+}
+
+// Manipulation procedures ----------------------------------------------------
+
+// skipClear()
+// Removes every item from S.
+void skipClear(SkipIndex S){
+    snode* x = S->head->forward[0].next;
+    while (x!=NULL){
+        snode* y = x->forward[0].next;
+        free(x);
+        x = y;
+    }
+    for (int i = 0; i<MAX_LEVEL; i++){
+        S->head->forward[i].next = NULL;
+        S->head->forward[i].width = 0;
+    }
+    S->level = 1;
+}
+
+// randomLevel()
+// Returns a level with P(level > k) = 4^-k.
+static int randomLevel(SkipIndex S){
+    int level = 1;
+    S->seed = S->seed*1103515245u + 12345u;
+    unsigned r = S->seed >> 8;
+    while (level<MAX_LEVEL && (r & 3)==0){
+        level++;
+        r >>= 2;
+    }
+    return level;
+}
+
+// findBefore()
+// Fills in the last node at every level whose start is before pos (or at pos
+// if inclusive is true), with the start of each in start[].
+static void findBefore(SkipIndex S, int pos, bool inclusive, snode** update, int* start){
+    snode* x = S->head;
+    int s = 0;
+    for (int i = MAX_LEVEL-1; i>=0; i--){
+        while (x->forward[i].next!=NULL
+               && (inclusive ? s + x->forward[i].width <= pos : s + x->forward[i].width < pos)){
+            s += x->forward[i].width;
+            x = x->forward[i].next;
+        }
+        update[i] = x;
+        start[i] = s;
+    }
+}
+
+// skipInsert()
+// Inserts item, covering size positions, so that it starts at element
+// position pos. Pre: pos is 0, the total size, or the start of an item
+void skipInsert(SkipIndex S, int pos, void* item, int size){
+    snode* update[MAX_LEVEL];
+    int start[MAX_LEVEL];
+    findBefore(S, pos, false, update, start);
+    int level = randomLevel(S);
+    if (level>S->level){
+        S->level = level;
+    }
+    snode* N = newSnode(item, size, level);
+    for (int i = 0; i<MAX_LEVEL; i++){
+        snode* x = update[i];
+        if (i<level){
+            snode* y = x->forward[i].next;
+            if (y!=NULL){
+                // y used to start at start[i]+width and moves back by size
+                N->forward[i].width = start[i] + x->forward[i].width + size - pos;
+            }
+            N->forward[i].next = y;
+            x->forward[i].next = N;
+            x->forward[i].width = pos - start[i];
+        }else if (x->forward[i].next!=NULL){
+            x->forward[i].width += size;
+        }
+    }
+}
+
+// skipRemove()
+// Removes the item that starts at element position pos.
+// Pre: an item starts at pos
+void skipRemove(SkipIndex S, int pos){
+    snode* update[MAX_LEVEL];
+    int start[MAX_LEVEL];
+    findBefore(S, pos, false, update, start);
+    snode* N = update[0]->forward[0].next;
+    if (N==NULL || start[0] + update[0]->forward[0].width != pos){
+        fprintf(stderr, "SkipIndex Error: skipRemove(): no item starts at %d\n", pos);
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i<MAX_LEVEL; i++){
+        snode* x = update[i];
+        if (i<N->level){
+            x->forward[i].next = N->forward[i].next;
+            x->forward[i].width = (N->forward[i].next!=NULL)
+                ? x->forward[i].width + N->forward[i].width - N->size : 0;
+        }else if (x->forward[i].next!=NULL){
+            x->forward[i].width -= N->size;
+        }
+    }
+    free(N);
+    while (S->level>1 && S->head->forward[S->level-1].next==NULL){
+        S->level--;
+    }
+}
+
+// skipResize()
+// Adds delta to the size of the item covering element position pos.
+// Pre: 0 <= pos < total size, the new size is at least 1
+void skipResize(SkipIndex S, int pos, int delta){
+    snode* update[MAX_LEVEL];
+    int start[MAX_LEVEL];
+    findBefore(S, pos, true, update, start);
+    if (update[0]==S->head){
+        fprintf(stderr, "SkipIndex Error: skipResize(): position out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    update[0]->size += delta;
+    for (int i = 0; i<MAX_LEVEL; i++){
+        if (update[i]->forward[i].next!=NULL){
+            update[i]->forward[i].width += delta;
+        }
+    }
+}
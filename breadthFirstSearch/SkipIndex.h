@@ -0,0 +1,59 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * SkipIndex.h
+ * Header file for skip list position index functions
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+// A SkipIndex is an indexable skip list over a sequence of items, where each
+// item covers size >= 1 consecutive element positions. Items are found by the
+// element position they cover in O(log n) expected time. The items themselves
+// are opaque pointers owned by the caller (List nodes or blocks).
+
+// Exported Types -------------------------------------------------------------
+
+typedef struct SkipIndexObj* SkipIndex;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newSkipIndex()
+// Creates a new empty index.
+SkipIndex newSkipIndex(void);
+
+// freeSkipIndex()
+// Frees heap memory associated with *pS, sets *pS to NULL.
+void freeSkipIndex(SkipIndex* pS);
+
+// Access functions -----------------------------------------------------------
+
+// skipFind()
+// Returns the item covering element position pos and sets *offset to the
+// index of pos inside that item. Pre: 0 <= pos < total size
+void* skipFind(SkipIndex S, int pos, int* offset);
+
+// Manipulation procedures ----------------------------------------------------
+
+// skipClear()
+// Removes every item from S.
+void skipClear(SkipIndex S);
+
+// skipInsert()
+// Inserts item, covering size positions, so that it starts at element
+// position pos. Pre: pos is 0, the total size, or the start of an item
+void skipInsert(SkipIndex S, int pos, void* item, int size);
+
+// skipRemove()
+// Removes the item that starts at element position pos.
+// Pre: an item starts at pos
+void skipRemove(SkipIndex S, int pos);
+
+// skipResize()
+// Adds delta to the size of the item covering element position pos.
+// Pre: 0 <= pos < total size, the new size is at least 1
+void skipResize(SkipIndex S, int pos, int delta);
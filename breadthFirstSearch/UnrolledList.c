@@ -0,0 +1,817 @@
+/***
+ * Morgan Stein
+ * mkstein
+ * 2026 Winter CSE101 PA2
+ * UnrolledList.c
+ * Definition of List.h functions using an unrolled linked list
+ ***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+#include "List.h"
+#include "SkipIndex.h"
+
+// Number of elements stored in each block. A block is never empty, and a
+// block that falls under half full is merged with the next one when they fit.
+#ifndef BLOCK_SIZE
+#define BLOCK_SIZE 32
+#endif
+
+typedef struct block{
+    int count;
+    struct block* next;
+    struct block* prev;
+    ListElement data[BLOCK_SIZE];
+} block;
+
+typedef struct ListObj{
+    block* front;
+    block* back;
+    block* cursor;      // block holding the cursor element
+    int offset;         // index of the cursor element in its block
+    int length;
+    int position;
+    SkipIndex index;    // NULL unless setIndexed() turned it on
+    bool stale;         // index must be rebuilt before its next use
+} ListObj;
+
+// Constructors-Destructors ---------------------------------------------------
+
+// newBlock()
+// Returns a pointer to a new empty block.
+static block* newBlock(void){
+    block* B = malloc(sizeof(block));
+    assert (B!=NULL);
+    B->count = 0;
+    B->next = NULL;
+    B->prev = NULL;
+    return (B);
+}
+
+// newList()
+// Creates a new empty list.
+List newList(){
+    List L;
+    L = malloc(sizeof(ListObj));
+    assert (L != NULL);
+    L->front = L->back = L->cursor = NULL;
+    L->offset = 0;
+    L->length = 0;
+    L->position = -1;
+    L->index = NULL;
+    L->stale = false;
+    return (L);
+}
+
+// newListFromArray()
+// Creates a new list holding A[0..n-1] in order. The cursor is undefined.
+List newListFromArray(const ListElement* A, int n){
+    List L = newList();
+    appendArray(L, A, n);
+    return (L);
+}
+
+// freeList()
+// Frees heap memory associated with *pL, sets *pL to NULL.
+void freeList(List* pL){
+    if (pL!=NULL && *pL!=NULL){
+        clear(*pL);
+        freeSkipIndex(&(*pL)->index);
+        free(*pL);
+        *pL=NULL;
+    }
+}
+
+// Access functions -----------------------------------------------------------
+
+// length()
+// Returns the number of elements in L.
+int length(List L){
+    if (L==NULL){
+        fprintf(stderr, "List Error: length(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    return(L->length);
+}
+
+// position()
+// If cursor is defined, returns the position of the cursor element, otherwise
+// returns -1.
+int position(List L){
+    if (L==NULL){
+        fprintf(stderr, "List Error: position(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    return(L->position);
+}
+
+// front()
+// Returns front element. Pre: length()>0
+ListElement front(List L){
+    if(length(L)==0){
+        fprintf(stderr, "List Error: front(): empty list\n");
+        exit(EXIT_FAILURE);
+    }
+    return(L->front->data[0]);
+}
+
+// back()
+// Returns back element. Pre: length()>0
+ListElement back(List L){
+    if(length(L)==0){
+        fprintf(stderr, "List Error: back(): empty list\n");
+        exit(EXIT_FAILURE);
+    }
+    return(L->back->data[L->back->count-1]);
+}
+
+// get()
+// Returns cursor element. Pre: length()>0, position()>=0
+ListElement get(List L){
+    if(length(L)==0){
+        fprintf(stderr, "List Error: get(): empty list\n");
+        exit(EXIT_FAILURE);
+    }
+    if(L->position == -1){
+        fprintf(stderr, "List Error: get(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
+    return(L->cursor->data[L->offset]);
+}
+
+// equals()
+// Returns true if A and B are the same integer sequence, false otherwise. The
+// cursor is not altered in either List.
+bool equals(List A, List B){
+    if (A==NULL || B==NULL){
+        fprintf(stderr, "List Error: equals(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (A->length != B->length){
+        return false;
+    }
+    block* M = A->front;
+    block* N = B->front;
+    int i = 0, j = 0;
+    while(M!=NULL){
+        if(M->data[i]!=N->data[j]){
+            return false;
+        }
+        if(++i==M->count){
+            M = M->next;
+            i = 0;
+        }
+        if(++j==N->count){
+            N = N->next;
+            j = 0;
+        }
+    }
+    return true;
+}
+
+// Manipulation procedures ----------------------------------------------------
+
+// linkAfter()
+// Links block N into L right after block B, or at the front if B is NULL.
+static void linkAfter(List L, block* B, block* N){
+    N->prev = B;
+    N->next = (B==NULL) ? L->front : B->next;
+    if(N->next!=NULL){
+        N->next->prev = N;
+    }else{
+        L->back = N;
+    }
+    if(B!=NULL){
+        B->next = N;
+    }else{
+        L->front = N;
+    }
+}
+
+// unlinkBlock()
+// Removes block B from the chain of L and frees it.
+static void unlinkBlock(List L, block* B){
+    if(B->prev!=NULL){
+        B->prev->next = B->next;
+    }else{
+        L->front = B->next;
+    }
+    if(B->next!=NULL){
+        B->next->prev = B->prev;
+    }else{
+        L->back = B->prev;
+    }
+    free(B);
+}
+
+// indexed()
+// Returns true if L has an index that single element edits must keep up to
+// date. Bulk relinking marks the index stale instead of patching it.
+static bool indexed(List L){
+    return L->index!=NULL && !L->stale;
+}
+
+// indexRefresh()
+// Rebuilds a stale index of L.
+static void indexRefresh(List L){
+    if (L->index!=NULL && L->stale){
+        skipClear(L->index);
+        int pos = 0;
+        for(block* B=L->front; B!=NULL; B=B->next){
+            skipInsert(L->index, pos, B, B->count);
+            pos += B->count;
+        }
+        L->stale = false;
+    }
+}
+
+// insertAt()
+// Inserts x at index i of block B, where it becomes element pos of L,
+// splitting B in half first if it is full. Keeps the cursor on its element
+// but does not change position.
+static void insertAt(List L, block* B, int i, int pos, ListElement x){
+    int start = pos-i;
+    if(B->count==0){
+        if(indexed(L)){
+            skipInsert(L->index, pos, B, 1);
+        }
+    }else if(B->count==BLOCK_SIZE){
+        int half = BLOCK_SIZE/2;
+        block* N = newBlock();
+        memcpy(N->data, B->data+half, (BLOCK_SIZE-half)*sizeof(ListElement));
+        N->count = BLOCK_SIZE-half;
+        B->count = half;
+        linkAfter(L, B, N);
+        if(indexed(L)){
+            skipResize(L->index, start, -N->count);
+            skipInsert(L->index, start+half, N, N->count);
+        }
+        if(L->cursor==B && L->offset>=half){
+            L->cursor = N;
+            L->offset -= half;
+        }
+        if(i>half){
+            B = N;
+            i -= half;
+            start += half;
+        }
+        if(indexed(L)){
+            skipResize(L->index, start, 1);
+        }
+    }else if(indexed(L)){
+        skipResize(L->index, start, 1);
+    }
+    memmove(B->data+i+1, B->data+i, (B->count-i)*sizeof(ListElement));
+    B->data[i] = x;
+    B->count++;
+    if(L->cursor==B && L->offset>=i){
+        L->offset++;
+    }
+    L->length++;
+}
+
+// deleteAt()
+// Deletes index i of block B, which is element pos of L. The cursor becomes
+// undefined if it was on the deleted element, otherwise it stays on its
+// element but position is not changed.
+static void deleteAt(List L, block* B, int i, int pos){
+    int start = pos-i;
+    if(L->cursor==B && L->offset==i){
+        L->cursor = NULL;
+        L->position = -1;
+    }else if(L->cursor==B && L->offset>i){
+        L->offset--;
+    }
+    memmove(B->data+i, B->data+i+1, (B->count-i-1)*sizeof(ListElement));
+    B->count--;
+    L->length--;
+    if(B->count==0){
+        if(indexed(L)){
+            skipRemove(L->index, start);
+        }
+        unlinkBlock(L, B);
+        return;
+    }
+    if(indexed(L)){
+        skipResize(L->index, start, -1);
+    }
+    block* N = B->next;
+    if(B->count<BLOCK_SIZE/2 && N!=NULL && B->count+N->count<=BLOCK_SIZE){
+        if(indexed(L)){
+            skipRemove(L->index, start+B->count);
+            skipResize(L->index, start, N->count);
+        }
+        if(L->cursor==N){
+            L->cursor = B;
+            L->offset += B->count;
+        }
+        memcpy(B->data+B->count, N->data, N->count*sizeof(ListElement));
+        B->count += N->count;
+        unlinkBlock(L, N);
+    }
+}
+
+// clear()
+// Resets L to its original empty state.
+void clear(List L){
+    if (L==NULL){
+        fprintf(stderr, "List Error: clear(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    block* B = L->front;
+    while(B!=NULL){
+        block* N = B->next;
+        free(B);
+        B = N;
+    }
+    if(L->index!=NULL){
+        skipClear(L->index);
+    }
+    L->stale = false;
+    L->front = L->back = L->cursor = NULL;
+    L->offset = 0;
+    L->length = 0;
+    L->position = -1;
+}
+
+// set()
+// Overwrites the cursor element’s data with x. Pre: length()>0, position()>=0
+void set(List L, ListElement x){
+    if (length(L)==0){
+        fprintf(stderr, "List Error: set(): List is empty\n");
+        exit(EXIT_FAILURE);
+    }
+    if (L->position == -1){
+        fprintf(stderr, "List Error: set(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
+    L->cursor->data[L->offset] = x;
+}
+
+// moveFront()
+// If L is non-empty, places the cursor under the front element, otherwise does
+// nothing.
+void moveFront(List L){
+    if(length(L)>0){
+        L->cursor = L->front;
+        L->offset = 0;
+        L->position = 0;
+    }
+}
+
+// moveBack()
+// If List is non-empty, places the cursor under the back element, otherwise
+// does nothing.
+void moveBack(List L){
+    if(length(L)>0){
+        L->cursor = L->back;
+        L->offset = L->back->count-1;
+        L->position = L->length-1;
+    }
+}
+
+// movePrev()
+// If cursor is defined and not at front, moves cursor one step toward front of
+// L, if cursor is defined and at front, cursor becomes undefined, if cursor is
+// undefined does nothing.
+void movePrev(List L){
+    if (L->cursor!=NULL){
+        if(L->offset>0){
+            L->offset--;
+            L->position--;
+        }else if(L->cursor->prev!=NULL){
+            L->cursor = L->cursor->prev;
+            L->offset = L->cursor->count-1;
+            L->position--;
+        }else{
+            L->cursor = NULL;
+            L->position = -1;
+        }
+    }
+}
+
+// moveNext()
+// If cursor is defined and not at back, moves cursor one step toward back of
+// L, if cursor is defined and at back, cursor becomes undefined, if cursor is
+// undefined does nothing.
+void moveNext(List L){
+    if (L->cursor!=NULL){
+        if(L->offset<L->cursor->count-1){
+            L->offset++;
+            L->position++;
+        }else if(L->cursor->next!=NULL){
+            L->cursor = L->cursor->next;
+            L->offset = 0;
+            L->position++;
+        }else{
+            L->cursor = NULL;
+            L->position = -1;
+        }
+    }
+}
+
+// prepend()
+// Insert new element into L. If List is non-empty, insertion takes place
+// before front element.
+void prepend(List L, ListElement data){
+    if(length(L)==0 || L->front->count==BLOCK_SIZE){
+        linkAfter(L, NULL, newBlock());
+    }
+    insertAt(L, L->front, 0, 0, data);
+    if(L->cursor!=NULL){
+        L->position++;
+    }
+}
+
+// append()
+// Insert new element into L. If List is non-empty, insertion takes place
+// after back element.
+void append(List L, ListElement data){
+    if(length(L)==0 || L->back->count==BLOCK_SIZE){
+        linkAfter(L, L->back, newBlock());
+    }
+    block* B = L->back;
+    if(indexed(L)){
+        if(B->count==0){
+            skipInsert(L->index, L->length, B, 1);
+        }else{
+            skipResize(L->index, L->length-1, 1);
+        }
+    }
+    B->data[B->count++] = data;
+    L->length++;
+}
+
+// appendArray()
+// Inserts A[0..n-1] in order after the back element of L, topping up the
+// back block and then filling whole new blocks. The cursor is unchanged.
+// Pre: n>=0
+void appendArray(List L, const ListElement* A, int n){
+    if (L==NULL){
+        fprintf(stderr, "List Error: appendArray(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (n<0){
+        fprintf(stderr, "List Error: appendArray(): negative count\n");
+        exit(EXIT_FAILURE);
+    }
+    if (n==0){
+        return;
+    }
+    L->length += n;
+    L->stale = (L->index!=NULL);
+    while (n>0){
+        if(L->back==NULL || L->back->count==BLOCK_SIZE){
+            linkAfter(L, L->back, newBlock());
+        }
+        block* B = L->back;
+        int k = BLOCK_SIZE-B->count;
+        if(k>n){
+            k = n;
+        }
+        memcpy(B->data+B->count, A, k*sizeof(ListElement));
+        B->count += k;
+        A += k;
+        n -= k;
+    }
+}
+
+// insertBefore()
+// Insert new element before cursor. Pre: length()>0, position()>=0
+void insertBefore(List L, ListElement data){
+    if (L->position == -1){
+        fprintf(stderr, "List Error: insertBefore(): Cursor position <0\n");
+        exit(EXIT_FAILURE);
+    }
+    insertAt(L, L->cursor, L->offset, L->position, data);
+    L->position++;
+}
+
+// insertAfter()
+// Inserts new element after cursor. Pre: length()>0, position()>=0
+void insertAfter(List L, ListElement data){
+    if (L->position == -1){
+        fprintf(stderr, "List Error: insertAfter(): Cursor position <0\n");
+        exit(EXIT_FAILURE);
+    }
+    insertAt(L, L->cursor, L->offset+1, L->position+1, data);
+}
+
+// deleteFront()
+// Deletes the front element. Pre: length()>0
+void deleteFront(List L){
+    if (length(L)==0){
+        fprintf(stderr, "List Error: deleteFront(): Empty List\n");
+        exit(EXIT_FAILURE);
+    }
+    if(L->position>0){
+        L->position--;
+    }
+    deleteAt(L, L->front, 0, 0);
+}
+
+// deleteBack()
+// Deletes the back element. Pre: length()>0
+void deleteBack(List L){
+    if (length(L)==0){
+        fprintf(stderr, "List Error: deleteBack(): Empty List\n");
+        exit(EXIT_FAILURE);
+    }
+    deleteAt(L, L->back, L->back->count-1, L->length-1);
+}
+
+// delete()
+// Deletes cursor element, making cursor undefined. Pre: length()>0, position()>=0
+void delete(List L){
+    if (length(L)==0){
+        fprintf(stderr, "List Error: delete(): Empty List\n");
+        exit(EXIT_FAILURE);
+    }
+    if (L->position == -1){
+        fprintf(stderr, "List Error: delete(): Cursor position <0\n");
+        exit(EXIT_FAILURE);
+    }
+    deleteAt(L, L->cursor, L->offset, L->position);
+}
+
+// concatInto()
+// Moves every element of B onto the back of A by relinking, in constant time,
+// leaving B empty. The cursor of A is unchanged and the cursor of B becomes
+// undefined. Pre: A != B
+void concatInto(List A, List B){
+    if (A==NULL || B==NULL){
+        fprintf(stderr, "List Error: concatInto(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (A==B){
+        fprintf(stderr, "List Error: concatInto(): A and B are the same List\n");
+        exit(EXIT_FAILURE);
+    }
+    if (B->length==0){
+        return;
+    }
+    if (A->length==0){
+        A->front = B->front;
+    }else{
+        A->back->next = B->front;
+        B->front->prev = A->back;
+    }
+    A->back = B->back;
+    A->length += B->length;
+    A->stale = (A->index!=NULL);
+    B->front = B->back = B->cursor = NULL;
+    B->offset = 0;
+    B->length = 0;
+    B->position = -1;
+    if (B->index!=NULL){
+        skipClear(B->index);
+    }
+}
+
+// spliceAt()
+// Moves every element of M into L just before the cursor element of L by
+// relinking, leaving M empty. The cursor of L stays under the same element.
+// Pre: length(L)>0, position(L)>=0, L != M
+void spliceAt(List L, List M){
+    if (L==NULL || M==NULL){
+        fprintf(stderr, "List Error: spliceAt(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (L==M){
+        fprintf(stderr, "List Error: spliceAt(): L and M are the same List\n");
+        exit(EXIT_FAILURE);
+    }
+    if (L->position == -1){
+        fprintf(stderr, "List Error: spliceAt(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
+    if (M->length==0){
+        return;
+    }
+    // cut the cursor block so the cursor element starts a block
+    block* C = L->cursor;
+    if (L->offset>0){
+        block* N = newBlock();
+        N->count = C->count-L->offset;
+        memcpy(N->data, C->data+L->offset, N->count*sizeof(ListElement));
+        C->count = L->offset;
+        linkAfter(L, C, N);
+        C = L->cursor = N;
+        L->offset = 0;
+    }
+    M->front->prev = C->prev;
+    M->back->next = C;
+    if (C->prev!=NULL){
+        C->prev->next = M->front;
+    }else{
+        L->front = M->front;
+    }
+    C->prev = M->back;
+    L->length += M->length;
+    L->position += M->length;
+    L->stale = (L->index!=NULL);
+    M->front = M->back = M->cursor = NULL;
+    M->offset = 0;
+    M->length = 0;
+    M->position = -1;
+    if (M->index!=NULL){
+        skipClear(M->index);
+    }
+}
+
+// splitAt()
+// Same result as split(), but the elements in front of the cursor are
+// detached by relinking instead of being copied one at a time.
+// Pre: length(L)>0, position(L)>=0
+List splitAt(List L){
+    if (length(L)==0){
+        fprintf(stderr, "List Error: splitAt(): List is Empty \n");
+        exit(EXIT_FAILURE);
+    }
+    // split() already relinks whole blocks and copies at most one partial one
+    return split(L);
+}
+
+// setIndexed()
+// If on is true, keeps a skip list index over L so that moveTo() and getAt()
+// take O(log n) time, at the cost of O(log n) inserts and deletes. If on is
+// false, drops the index.
+void setIndexed(List L, bool on){
+    if (L==NULL){
+        fprintf(stderr, "List Error: setIndexed(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    if (on && L->index==NULL){
+        L->index = newSkipIndex();
+        L->stale = true;
+    }else if (!on){
+        freeSkipIndex(&L->index);
+        L->stale = false;
+    }
+}
+
+// blockAt()
+// Returns the block holding index i and sets *offset to its index in the
+// block, from the index if L has one, otherwise by walking blocks from the
+// closer end.
+static block* blockAt(List L, int i, int* offset){
+    if (L->index!=NULL){
+        indexRefresh(L);
+        return skipFind(L->index, i, offset);
+    }
+    block* B;
+    if (i < L->length-i){
+        int start = 0;
+        for (B=L->front; start+B->count<=i; B=B->next){
+            start += B->count;
+        }
+        *offset = i-start;
+    }else{
+        int start = L->length-L->back->count;
+        for (B=L->back; start>i; B=B->prev){
+            start -= B->prev->count;
+        }
+        *offset = i-start;
+    }
+    return B;
+}
+
+// moveTo()
+// Places the cursor under the element at index i. Pre: 0 <= i < length()
+void moveTo(List L, int i){
+    if (i<0 || i>=length(L)){
+        fprintf(stderr, "List Error: moveTo(): index out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    L->cursor = blockAt(L, i, &L->offset);
+    L->position = i;
+}
+
+// getAt()
+// Returns the element at index i. The cursor is not altered.
+// Pre: 0 <= i < length()
+ListElement getAt(List L, int i){
+    if (i<0 || i>=length(L)){
+        fprintf(stderr, "List Error: getAt(): index out of range\n");
+        exit(EXIT_FAILURE);
+    }
+    int offset;
+    block* B = blockAt(L, i, &offset);
+    return B->data[offset];
+}
+
+// Other operations -----------------------------------------------------------
+
+// printList()
+// Prints a string representation of L consisting of a comma separated sequence
+// of integers, surrounded by parentheses, with front on left, to the stream
+// pointed to by out.
+void printList(FILE* out, List L){
+    if (L==NULL){
+        fprintf(stderr, "List Error: printList(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    fprintf(out,"(");
+    for(block* B=L->front; B!=NULL; B=B->next){
+        for(int i=0; i<B->count; i++){
+            fprintf(out,FORMAT, B->data[i]);
+            if(i<B->count-1 || B->next!=NULL){
+                fprintf(out,", ");
+            }
+        }
+    }
+    fprintf(out,")\n");
+}
+
+// toArray()
+// Copies the elements of L, front to back, into out[0..length(L)-1] and
+// returns length(L). The cursor is not altered.
+// Pre: out has room for length(L) elements
+int toArray(List L, ListElement* out){
+    if (L==NULL){
+        fprintf(stderr, "List Error: toArray(): NULL List reference\n");
+        exit(EXIT_FAILURE);
+    }
+    int i = 0;
+    for(block* B=L->front; B!=NULL; B=B->next){
+        memcpy(out+i, B->data, B->count*sizeof(ListElement));
+        i += B->count;
+    }
+    return i;
+}
+
+// appendBlocks()
+// Appends copies of the blocks from B to the end of the chain onto M.
+static void appendBlocks(List M, block* B){
+    for(; B!=NULL; B=B->next){
+        block* N = newBlock();
+        memcpy(N->data, B->data, B->count*sizeof(ListElement));
+        N->count = B->count;
+        linkAfter(M, M->back, N);
+        M->length += B->count;
+    }
+}
+
+// copyList()
+// Returns a new List representing the same integer sequence as L. The cursor
+// in the new list is undefined, regardless of the state of the cursor in L. The
+// List L is unchanged.
+List copyList(List L){
+    List M = newList();
+    appendBlocks(M, L->front);
+    return M;
+}
+
+// join()
+// Returns the concatenation of A followed by B. The cursor in the new List is
+// undefined, regardless of the states of the cursors A in and B. The states of
+// A and B are unchanged.
+List join(List A, List B){
+    List L = newList();
+    appendBlocks(L, A->front);
+    appendBlocks(L, B->front);
+    return L;
+}
+
+// split()
+// Removes all elements before (in front of but not equal to) the cursor element
+// in L. The cursor element in L is unchanged. Returns a new List consisting of
+// all the removed elements. The cursor in the returned list is undefined.
+// Pre: length(L)>0, position(L)>=0
+List split(List L){
+    List M = newList();
+    if (length(L)==0){
+        fprintf(stderr, "List Error: split(): List is Empty \n");
+        exit(EXIT_FAILURE);
+    }
+    if (L->position == -1){
+        fprintf(stderr, "List Error: split(): cursor undefined\n");
+        exit(EXIT_FAILURE);
+    }
+    block* C = L->cursor;
+    // whole blocks in front of the cursor block move over as they are
+    if(C!=L->front){
+        M->front = L->front;
+        M->back = C->prev;
+        M->back->next = NULL;
+        C->prev = NULL;
+        L->front = C;
+    }
+    if(L->offset>0){
+        block* N = newBlock();
+        memcpy(N->data, C->data, L->offset*sizeof(ListElement));
+        N->count = L->offset;
+        linkAfter(M, M->back, N);
+        memmove(C->data, C->data+L->offset, (C->count-L->offset)*sizeof(ListElement));
+        C->count -= L->offset;
+        L->offset = 0;
+    }
+    M->length = L->position;
+    L->length -= L->position;
+    L->position = 0;
+    L->stale = (L->index!=NULL);
+    return M;
+}